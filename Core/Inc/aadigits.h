@@ -0,0 +1,24 @@
+/**
+  ******************************************************************************
+  * @file    aadigits.h
+  * @brief   This file contains the anti-aliased MAIN digit tables
+  *          from aadigits.c
+  ******************************************************************************
+*/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef AADIGITS_H
+#define AADIGITS_H
+
+#include <stdint.h>
+
+#define AA_DIGIT_GLYPHS			15			// Glyphs in aaDigitRle[]
+#define AA_DIGIT_RLE_BYTES		6735		// Whole table
+#define AA_DIGIT_LEVELS			16			// Coverage 0 = background .. 15 = foreground
+
+extern const char aaDigitCodes[AA_DIGIT_GLYPHS + 1];
+extern const uint16_t aaDigitOffset[AA_DIGIT_GLYPHS + 1];
+extern const uint8_t aaDigitRle[AA_DIGIT_RLE_BYTES];
+
+
+#endif // AADIGITS_H
@@ -26,6 +26,16 @@ void DisplayMain(void);
 void DisplayAuxFirstHalf(void);
 void DisplayAuxSecondHalf(void);
 void DisplayAnnunciatorsHalf(void);
+void DisplayAnnunciators(void);
+void ShiftUnitsRight(char* text1);
+void FixUnitText(char* text1);
+void DisplayCloneDeterminationAux(void);
+void BuildMainGlyphAtlas(void);
+void LoadMainFont(void);
+void InitAnnunciatorLayer(void);
+
+extern volatile uint32_t annuncSpiBytesPerSec;
+extern volatile uint32_t mainSpiBytesPerSec;
 
 
 // Display coords
@@ -34,6 +44,39 @@ void DisplayAnnunciatorsHalf(void);
 #define Xpos_ANNUNC				165
 #define Xpos_SPLASH				142
 #define Ypos_SPLASH				220
+#define MAIN_CHARS				14			// Characters in the MAIN line
+#define MAIN_CHAR_PITCH			68			// MAIN cell pitch along Y: 16 dot wide 32-dot CGROM glyph x4 + 4 character spacing
+#define ANNUNC_CHAR_PITCH		16			// Annunciator cell pitch along Y: 8 dot wide 16-dot CGROM glyph x2, no spacing
+#define ANNUNC_CHAR_HEIGHT		32			// Annunciator glyph height along X: 16-dot CGROM glyph x2
+#define MAIN_CHAR_HEIGHT		128			// MAIN glyph height along X: 32-dot CGROM glyph x4
+
+// Annunciator layer - the annunciator strip is an LT7680 PIP1 window over its own image at LT7680_PIP_ADDR
+#ifndef ANNUNC_PIP
+#define ANNUNC_PIP				1			// 0 = annunciators drawn into the main image (original). Can be overridden from the project preprocessor definitions
+#endif
+#define ANNUNC_PIP_X			164			// Strip along Y at Xpos_ANNUNC, PIP window X and width are multiples of 4
+#define ANNUNC_PIP_WIDTH		36			// Covers Xpos_ANNUNC .. Xpos_ANNUNC + ANNUNC_CHAR_HEIGHT - 1
+
+// MAIN user-defined font - mainfont.c glyphs in the LT7680 CGRAM instead of the internal CGROM
+#ifndef MAIN_USER_FONT
+#define MAIN_USER_FONT			1			// 0 = internal CGROM only (original). Can be overridden from the project preprocessor definitions
+#endif
+
+// MAIN glyph atlas - every MAIN character pre-rendered off-screen once, DisplayMain() BTE copies cells from it
+#ifndef MAIN_GLYPH_ATLAS
+#define MAIN_GLYPH_ATLAS		0			// 1 = enable. Off: one BTE copy per cell costs more SPI than the text run (sim: 252 vs 78 bytes
+										// on a full MAIN line) plus ~2.5KB at boot, and cell placement is unconfirmed on the panel
+#endif
+#define MAIN_ATLAS_ADDR			0x00200000	// SDRAM byte address, clear of the 240x960x2 visible image at MAIN_IMAGE_START
+#define MAIN_ATLAS_GLYPHS		96			// 0x20-0x7E, then 0xB5 (micro) from FixUnitText()
+#define MAIN_ATLAS_WIDTH		MAIN_CHAR_HEIGHT			// One cell per row along Y
+#define MAIN_ATLAS_HEIGHT		(MAIN_ATLAS_GLYPHS * MAIN_CHAR_PITCH)
+
+// MAIN anti-aliased digits - aadigits.c glyphs streamed as RGB565 pixels in graphic mode on SPI1 TX DMA, see DrawMainAaDigit()
+#ifndef MAIN_AA_DIGITS
+#define MAIN_AA_DIGITS			0			// 1 = digits and punctuation anti-aliased, needs CS held over a whole memory write (as LT7680_XFER_BURST). Can be overridden from the project preprocessor definitions
+#endif
+#define MAIN_AA_CHUNK_PIXELS	256			// Pixels per DMA chunk, two buffers of this in RAM
 
 
 #endif // DISPLAY_H
\ No newline at end of file
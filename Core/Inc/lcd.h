@@ -6,6 +6,6 @@
   ******************************************************************************
 */
 
-// It's lonely here!
+void BuyDisplay_Init(void);
 
 
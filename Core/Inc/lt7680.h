@@ -22,6 +22,74 @@ void WriteData(uint8_t data);
 uint8_t ReadStatus(void);
 uint8_t ReadData(void);
 void WriteDataToRegister(uint8_t reg, uint8_t value);
+void WriteRegisterBurst(const uint8_t* regValues, uint8_t pairs);
+
+// SPI1 clock calibration
+typedef struct {
+	uint32_t spiClockHz;		// SPI1 clock in use after LT7680_SpiAutoTune()
+	uint32_t prescaler;			// SPI_BAUDRATEPRESCALER_x in use
+	uint8_t overridden;			// 1 = LT7680_SPI_PRESCALER fixed the clock, no calibration ran
+	uint8_t chosenStep;			// Index into the 36/18/9 MHz step table
+	uint8_t fastestPassStep;	// Fastest step with zero errors, 0xFF = none
+	uint32_t tests[3];			// Write/readback checks per step (36, 18, 9 MHz)
+	uint32_t errors[3];			// Readback mismatches per step
+} LT7680_SpiTuneDiag;
+
+extern volatile LT7680_SpiTuneDiag lt7680SpiTune;
+void LT7680_SpiAutoTune(void);
+
+// Render profiling - SPI cost of one call
+typedef struct {
+	uint32_t calls;
+	uint32_t lastBytes;			// SPI bytes sent (or queued) by the last call
+	uint32_t lastXfers;			// CS transactions
+	uint32_t lastBusUs;			// Modelled bus time, lastBytes x 8 / SPI1 clock
+	uint32_t maxBusUs;
+	uint32_t totalBytes;
+} LT7680_RenderProfile;
+
+#define LT7680_PROFILE_BEGIN()		uint32_t lt7680Bytes0 = lt7680SpiBytes, lt7680Xfers0 = lt7680SpiXfers
+#define LT7680_PROFILE_END(prof)	LT7680_ProfileEnd(&(prof), lt7680Bytes0, lt7680Xfers0)
+void LT7680_ProfileEnd(volatile LT7680_RenderProfile* prof, uint32_t bytes0, uint32_t xfers0);
+
+extern volatile LT7680_RenderProfile lt7680ProfClearScreen;
+extern volatile LT7680_RenderProfile lt7680ProfUserFont;
+extern volatile uint32_t lt7680UserFontUploadUs;
+
+// SPI1 transport microbenchmark
+typedef struct {
+	uint32_t spiClockHz;		// SPI1 clock during the run
+	uint32_t halBytesPerSec;	// HAL_SPI_Transmit() path
+	uint32_t halXfersPerSec;	// CS transactions (2 bytes each)
+	uint32_t llBytesPerSec;		// SPI1->DR/SR path
+	uint32_t llXfersPerSec;
+} LT7680_SpiBenchResult;
+
+extern volatile LT7680_SpiBenchResult lt7680SpiBench;
+void LT7680_SpiBenchmark(void);
+
+// Asynchronous command queue (SPI1 TX DMA)
+void LT7680_QueueEnable(uint8_t enable);
+void LT7680_QueueService(void);
+void LT7680_QueueTxComplete(void);
+void LT7680_QueueTick(void);
+
+extern volatile uint32_t lt7680SpiBytes;	// SPI1 bytes to/from the LT7680 since boot
+extern volatile uint32_t lt7680SpiXfers;	// SPI1 CS transactions since boot
+extern volatile uint32_t lt7680RegWritesIssued;		// WriteDataToRegister() writes sent
+extern volatile uint32_t lt7680RegWritesSuppressed;	// WriteDataToRegister() writes skipped by the register shadow
+extern volatile uint32_t lt7680TextChunks;			// DrawText() chunks, one FIFO status check each
+extern volatile uint32_t lt7680WaitTimeouts;		// Status waits (queued or blocking) that gave up after LT7680_WAIT_TIMEOUT_MS
+extern volatile uint32_t lt7680QueueHighWater;		// Most bytes ever waiting in the command queue
+extern volatile uint32_t lt7680QueueStalls;			// Enqueues that waited for the DMA to make room
+extern volatile uint32_t lt7680QueueFences;			// Reads that drained a non-empty queue first
+extern volatile uint32_t lt7680QueueWaitRetries;	// Status waits that found the LT7680 busy and were retried from SysTick
+extern volatile uint32_t lt7680PageFlips;			// MISA switches
+extern volatile uint32_t lt7680PageForwardRects;	// BTE copies bringing the back page up to date
+extern volatile uint32_t lt7680StreamBlocks;		// LT7680_StreamBegin() calls
+extern volatile uint32_t lt7680StreamChunks;		// Pixel DMA transfers
+extern volatile uint32_t lt7680StreamBlockUs;		// Wall time of the last streamed block
+extern volatile uint32_t lt7680StreamWaitUs;		// Of which the CPU waited for the DMA
 
 // Testing routines
 //void OriginalFillSDRAM_LT(void);
@@ -49,9 +117,24 @@ void SendAllToLT7680_LT(void);
 void Text_Mode(void);
 void SetTextColors(uint32_t foreground, uint32_t background);
 //void SetFontTypeSize(uint8_t fontType, uint8_t fontSize);
-//void SetTextCursor(uint16_t x, uint16_t y);
-//void DrawText(char* text);
-//void ConfigureFontAndPosition(uint8_t fontSource, uint8_t characterHeight, uint8_t isoCoding, uint8_t fullAlignment, uint8_t chromaKeying, uint8_t rotation, uint8_t widthFactor, uint8_t heightFactor, uint8_t lineGap, uint8_t charSpacing, uint16_t cursorX, uint16_t cursorY)
+void SetTextCursor(uint16_t x, uint16_t y);
+void DrawFilledRectangle(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint32_t color);
+void FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t colour);
+void SetCanvas(uint32_t address, uint16_t width, uint16_t height);
+void CopyRect(uint32_t srcAddr, uint16_t srcWidth, uint16_t srcX, uint16_t srcY, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void LT7680_PageInit(void);
+uint32_t LT7680_PageBackAddr(void);
+void LT7680_PageDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void LT7680_PageBegin(void);
+void LT7680_PageFlip(void);
+void LT7680_PipEnable(uint32_t address, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void LT7680_UserFontUpload(const char* codes, const uint8_t* glyphs, uint8_t glyphBytes);
+void LT7680_StreamBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void LT7680_StreamChunk(const uint8_t* data, uint16_t len);
+void LT7680_StreamEnd(void);
+void DrawText(const char* text);
+void ConfigureFontAndPosition(uint8_t fontSource, uint8_t characterHeight, uint8_t isoCoding, uint8_t fullAlignment, uint8_t chromaKeying, uint8_t rotation, uint8_t widthFactor, uint8_t heightFactor, uint8_t lineGap, uint8_t charSpacing, uint16_t cursorX, uint16_t cursorY);
+void DrawLine(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint16_t colorRED, uint16_t colorGREEN, uint16_t colorBLUE);
 
 // Register Configuration
 void LT7680_PLL_Initial_LT(void);
@@ -68,9 +151,11 @@ void LCD_VSYNC_Start_Position_LT(uint16_t val);
 void LCD_VSYNC_Pulse_Width_LT(uint16_t val);
 void LCDConfig_LT(void);
 void LCDTurnOn_LT(void);
+void LCDConfigTurnOn_LT(void);
 void PWM_Prescaler_LT(void);
 void PWM_Clock_Mux_LT(void);
 void PWM_Configuration_LT(void);
+void ConfigurePWMAndSetBrightness(uint8_t brightnessPercentage);
 void Software_Reset_LT(void);
 void Software_ResetPLL_LT(void);
 void Set_MISA_LT(void);
@@ -83,7 +168,7 @@ void ResetGraphicWritePosition_LT(void);
 void SetGraphicRWYCoordinate_LT(void);
 void SetCanvasStartAddress_LT(void);
 void SetCanvasImageWidth_LT(void);
-//void ClearScreen(void);
+void ClearScreen(void);
 
 // Pin definitions for LT7680 controller
 // The SCK, MOSI, MISO, and CS pins are defined and configured as part of the SPI peripheral initialization in the STM32 HAL driver setup.
@@ -145,4 +230,71 @@ void SetCanvasImageWidth_LT(void);
 #define BACKLIGHTFULL			10			// Backlighting brightness 0-100%
 #define BACKLIGHTOFF			0			// Backlighting brightness 0-100%
 
+// SPI1 transport for register writes, see WriteRegisterBurst()
+#define LT7680_XFER_BYTE		0			// Original: control and payload bytes as separate 1 byte HAL transfers
+#define LT7680_XFER_PAIR		1			// Control + payload as one 2 byte transfer per CS cycle
+#define LT7680_XFER_BURST		2			// Register bursts as one transfer with CS held across the sequence
+#ifndef LT7680_SPI_TRANSPORT
+#define LT7680_SPI_TRANSPORT	LT7680_XFER_PAIR	// Can be overridden from the project preprocessor definitions
+#endif
+#define LT7680_BURST_MAX_PAIRS	16			// Largest WriteRegisterBurst() sequence
+
+// SPI1 driver for the blocking paths (DMA queue always uses HAL_SPI_Transmit_DMA)
+#define LT7680_DRV_HAL			0			// HAL_SPI_Transmit()/Receive() with HAL_MAX_DELAY (original)
+#define LT7680_DRV_LL			1			// Direct SPI1->DR/SR access, TXE/BSY polling
+#ifndef LT7680_SPI_DRIVER
+#define LT7680_SPI_DRIVER		LT7680_DRV_LL	// Can be overridden from the project preprocessor definitions
+#endif
+#ifndef LT7680_LL_FRAME16
+#define LT7680_LL_FRAME16		0			// 1 = 16-bit SPI frames, control + payload in one DR write
+#endif
+#ifndef LT7680_SPI_BENCH
+#define LT7680_SPI_BENCH		0			// 1 = run LT7680_SpiBenchmark() at boot, results in lt7680SpiBench
+#endif
+#define LT7680_SPI_BENCH_COUNT	2000		// Transactions per benchmark pass
+
+// SPI1 clock calibration at boot, see LT7680_SpiAutoTune()
+//#define LT7680_SPI_PRESCALER	SPI_BAUDRATEPRESCALER_8		// Define to fix the SPI1 clock and skip calibration
+#define LT7680_SPI_TUNE_PATTERNS	32		// Patterns per scratch register per step
+#define LT7680_SPI_TUNE_SOAK		4		// The fastest passing step must also pass this many times the patterns
+#define LT7680_SPI_TUNE_BACKOFF		1		// Safety margin: steps slower than the fastest that passed the soak, >= 1 keeps SPI1 <= 18MHz
+
+// Text writes
+#define LT7680_TEXT_CHUNK		16			// DrawText() characters per FIFO check, back-to-back writes failed beyond ~22
+
+// STSR (status read) bits
+#define LT7680_STSR_WR_FIFO_FULL	0x80	// Memory write FIFO full
+#define LT7680_STSR_WR_FIFO_EMPTY	0x40	// Memory write FIFO empty
+#define LT7680_STSR_CORE_BUSY		0x08	// Core task busy (text, draw and BTE engines)
+
+// Asynchronous command queue - writes go out on SPI1 TX DMA after LT7680_QueueEnable(1)
+#ifndef LT7680_ASYNC_QUEUE
+#define LT7680_ASYNC_QUEUE		1			// 0 = every LT7680 access blocks (original)
+#endif
+#define LT7680_QUEUE_SIZE		1024		// Ring bytes, a full MAIN + annunciator frame fits with room to spare
+#define LT7680_QUEUE_MAX_XFER	(4 * LT7680_BURST_MAX_PAIRS)	// Largest single CS transaction
+#define LT7680_QUEUE_IRQ_PRIO	14			// DMA1 Channel 3, below every capture interrupt (one STSR read per status wait pass)
+#define LT7680_WAIT_TIMEOUT_MS	100			// Status waits give up after this long (LT7680 not answering)
+
+// Display pages - draw into a back page and flip MISA at Vsync, see LT7680_PageFlip()
+#ifndef LT7680_DISPLAY_PAGES
+#define LT7680_DISPLAY_PAGES	2			// 1 = draw straight into the visible image (original). Can be overridden from the project preprocessor definitions
+#endif
+#define LT7680_PAGE_SIZE		0x00080000	// SDRAM bytes per page, 240x960x2 rounded up, pages stay below MAIN_ATLAS_ADDR
+#define LT7680_PAGE_DIRTY_MAX	32			// Dirty rectangles per frame before the whole page is copied forward
+
+// PIP1 layer image, see LT7680_PipEnable()
+#define LT7680_PIP_ADDR			0x00100000	// SDRAM byte address, panel sized 16bpp, after the display pages
+
+// User-defined font, see LT7680_UserFontUpload()
+#define LT7680_CGRAM_ADDR		0x00180000	// SDRAM byte address, 256 codes x 64 bytes, between the display pages and MAIN_ATLAS_ADDR
+
+#if LT7680_DISPLAY_PAGES > 2
+#error "LT7680_DISPLAY_PAGES: 1 or 2, the back page is brought up to date from the front after every flip"
+#endif
+
+#if LT7680_LL_FRAME16 && (LT7680_SPI_DRIVER != LT7680_DRV_LL || LT7680_SPI_TRANSPORT != LT7680_XFER_PAIR || LT7680_ASYNC_QUEUE)
+#error "LT7680_LL_FRAME16 needs LT7680_DRV_LL, LT7680_XFER_PAIR and LT7680_ASYNC_QUEUE 0 (every transaction a 16-bit control + payload frame)"
+#endif
+
 #endif
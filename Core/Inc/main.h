@@ -58,6 +58,44 @@ extern volatile uint8_t syncState; // Holds the SYNC pin state
 #define DMM_PWO_Pin GPIO_PIN_12					// PB12
 #define DMM_PWO_GPIO_Port GPIOB
 
+#define DMM_O2_SPI_Pin GPIO_PIN_13				// PB13 - SPI2_SCK, link to O2 (PB1) when using the SPI2 capture engine
+#define DMM_O2_SPI_GPIO_Port GPIOB
+
+// 3457A capture engine selection
+#define DMM_CAPTURE_ISR			0			// TIM3 CH4 interrupt on every O2 edge, bits read one at a time (original)
+#define DMM_CAPTURE_SPI2		1			// O2 clocks SPI2 as slave, ISA/INA bytes DMA'd into a ring, CPU wakes per SYNC edge
+#define DMM_CAPTURE_DMA			2			// O2 edge DMAs a GPIOB->IDR snapshot into a ring, decoded in batches
+#ifndef DMM_CAPTURE_ENGINE
+#define DMM_CAPTURE_ENGINE		DMM_CAPTURE_ISR		// Can be overridden from the project preprocessor definitions
+#endif
+
+// Main loop - event driven, sleeps (WFI) until the decoder publishes a new frame
+#ifndef DISPLAY_MAX_FPS
+#define DISPLAY_MAX_FPS			30			// Upper limit on LT7680 redraws per second, extra frames coalesce into the next redraw
+#endif
+#define DISPLAY_MIN_FRAME_MS	(1000 / DISPLAY_MAX_FPS)
+#define DISPLAY_HOUSEKEEPING_MS	5			// Capture engine flush interval while idle, bounds SPI2/DMA frame latency
+
+// Interrupt priorities (NVIC_PRIORITYGROUP_4, 0 = most urgent) - the whole ladder, set where noted
+//   1  EXTI15_10  SYNC edge, SPI2 engine realigns before the next O2 edge  gpio.c
+//   2  TIM3       O2 edge, ISR engine, up to ~55kHz                        gpio.c
+//   3  DMA1 Ch4   SPI2 capture ring drain                                  dma.c
+//   3  DMA1 Ch2   GPIOB sample ring decode                                 dma.c
+//   3  DMA1 Ch3   SPI1 TX, only with LT7680_ASYNC_QUEUE 0                  dma.c
+//  14  DMA1 Ch3   LT7680 command queue (LT7680_QUEUE_IRQ_PRIO)             lt7680.h
+//  15  PendSV     DMM_FrameBuild()                                         timer.c
+//  15  SysTick    HAL tick, LT7680 status wait retry (TICK_INT_PRIORITY)   stm32f1xx_hal_conf.h
+// Capture decode (3) only yields to the capture edges, everything display related runs below it.
+
+typedef struct {
+	uint32_t framesPerSec;		// Frames rendered to the LT7680 over the last second
+	uint32_t idlePercent;		// CPU time asleep in WFI over the last second
+	uint32_t wakeupsPerSec;		// Main loop passes over the last second
+	uint32_t framesRendered;	// Total since boot
+} MainLoopStats;
+
+extern volatile MainLoopStats mainLoopStats;
+
 // Note: PB10 lt7680 reset pin is in lt7680.h
 	
 // The number of bytes in one data packet loaded into the U4 shift register
@@ -0,0 +1,22 @@
+/**
+  ******************************************************************************
+  * @file    mainfont.h
+  * @brief   This file contains the user-defined MAIN font tables
+  *          from mainfont.c
+  ******************************************************************************
+*/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MAINFONT_H
+#define MAINFONT_H
+
+#include <stdint.h>
+
+#define MAIN_FONT_GLYPHS		53			// Glyphs in mainFont16x32[]
+#define MAIN_FONT_GLYPH_BYTES	64			// 16x32 dots, 1bpp
+
+extern const char mainFontCodes[MAIN_FONT_GLYPHS + 1];
+extern const uint8_t mainFont16x32[MAIN_FONT_GLYPHS][MAIN_FONT_GLYPH_BYTES];
+
+
+#endif // MAINFONT_H
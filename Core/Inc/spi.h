@@ -19,9 +19,11 @@ extern "C" {
 
 extern SPI_HandleTypeDef hspi1;
 
-//extern SPI_HandleTypeDef hspi2;
+extern SPI_HandleTypeDef hspi2;
+extern DMA_HandleTypeDef hdma_spi2_rx;
 
 void MX_SPI1_Init(void);
+void MX_SPI2_Init(void);
 
 #ifdef __cplusplus
 }
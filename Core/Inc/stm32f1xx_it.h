@@ -55,8 +55,9 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void DMA1_Channel2_IRQHandler(void);
 void DMA1_Channel3_IRQHandler(void);
-//void DMA1_Channel4_IRQHandler(void);
+void DMA1_Channel4_IRQHandler(void);
 //void SPI2_IRQHandler(void);
 void EXTI15_10_IRQHandler(void);
 /* USER CODE BEGIN EFP */
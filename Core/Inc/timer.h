@@ -13,6 +13,34 @@
 #include "stm32f1xx_hal.h"
 #include "stm32f1xx_hal_tim.h" // For TIM APIs and TIM_HandleTypeDef
 
+//***********************************************************************************
+// Decoder instrumentation (Live Watch counters, bit logs and debug strings in timer.c)
+
+#define DMM_INSTR_OFF			0			// production - no instrumentation code or RAM at all
+#define DMM_INSTR_COUNTERS		1			// event counters and DWT cycle measurements only
+#define DMM_INSTR_TRACE			2			// counters + bit/command logs and debug decode tables (full Live Watch)
+#ifndef DMM_INSTRUMENT
+#define DMM_INSTRUMENT			DMM_INSTR_TRACE		// Can be overridden from the project preprocessor definitions
+#endif
+
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+#define DMM_COUNT(var)			((var)++)
+#define DMM_STAT(...)			do { __VA_ARGS__; } while (0)
+#define DMM_CYCLES_BEGIN()		uint32_t dmmCycles0 = DWT->CYCCNT
+#define DMM_CYCLES_END(last, max)	do { (last) = DWT->CYCCNT - dmmCycles0; if ((last) > (max)) (max) = (last); } while (0)
+#else
+#define DMM_COUNT(var)			((void)0)
+#define DMM_STAT(...)			((void)0)
+#define DMM_CYCLES_BEGIN()		do { } while (0)
+#define DMM_CYCLES_END(last, max)	((void)0)
+#endif
+
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
+#define DMM_TRACE(...)			do { __VA_ARGS__; } while (0)
+#else
+#define DMM_TRACE(...)			((void)0)
+#endif
+
 //***********************************************************************************
 // Timer 2
 
@@ -20,8 +48,10 @@
 extern volatile uint8_t timer_flag;
 extern volatile uint8_t task_ready;
 
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
 extern volatile uint8_t isaBuffer[256];
 extern volatile uint8_t inaBuffer[256];
+#endif
 
 extern volatile uint8_t logReady;
 
@@ -45,7 +75,10 @@ extern TIM_HandleTypeDef htim3;
 // External SYNC state variable
 extern volatile uint8_t syncState;
 
-void DMM_HandleO2Clock(void);
+void DMM_HandleO2Clock(uint32_t idr);
+
+#define DMM_RAMFUNC				__attribute__((section(".RamFunc"), noinline))	// copied to RAM at startup, see linker script
+#define DMM_O2_CYCLE_BUDGET		327			// 72MHz / (4 x 55kHz max O2) - TIM3 IRQ must stay under this
 void MX_TIM3_Init(void);
 
 // Externally accessible variables for TIM3
@@ -57,6 +90,73 @@ void TIM3_Init_InputCapture(void);
 void TIM3_IRQHandler(void);
 uint16_t TIM3_GetCapturedValue(void);
 
+// Capture engine (selected by DMM_CAPTURE_ENGINE in main.h)
+void DMM_CaptureStart(void);
+void DMM_CaptureService(void);
+uint8_t DMM_DecodeWords(const uint8_t* words, uint8_t len, uint8_t pos);
+
+// Display string building
+#define DMM_DEFERRED_BUILD		1			// 1 = build in PendSV after the frame is latched, 0 = inside the capture ISR (compare o2IsrCyclesMax)
+
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+extern volatile uint32_t o2IsrCycles;
+extern volatile uint32_t o2IsrCyclesMax;
+extern volatile uint32_t o2IsrOverBudget;
+extern volatile uint32_t frameBuildCycles;
+extern volatile uint32_t frameBuildCyclesMax;
+#endif
+
+void DMM_FrameBuild(void);
+
+// Decoded frame handed from the decoder to the render loop (seqlock, see DMM_FrameSnapshot)
+typedef struct {
+    uint32_t seq;               // frame generation, increments only when the register/annunciator content changes
+    uint32_t tick;              // HAL_GetTick() when the frame was captured
+    char     text[32];          // displayWithPunct
+    char     chars[13];         // displayStr, 12 chars + \0
+    char     punct[13];         // punctStr, ' ', '.', ':' or ',' per char + \0
+    uint8_t  annunc[13];        // Annunc[1..12], index 0 unused
+} DMM_Frame;
+
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+extern volatile uint32_t frameSnapshotRetries;
+extern volatile uint32_t frameUnchangedCount;
+#endif
+
+void DMM_FrameSnapshot(DMM_Frame* out);
+uint32_t DMM_FrameGeneration(void);
+
+//***********************************************************************************
+// SPI2 capture engine
+
+#define SPI2_RING_SIZE			256			// DMA byte ring, power of two
+#define SPI2_TXN_COUNT			16			// SYNC-delimited transactions queued for the decoder, power of two
+#define SPI2_TXN_NOPWO			0x8000u		// Transaction start flag: PWO low, display not selected
+
+extern uint8_t spi2Ring[SPI2_RING_SIZE];
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+extern volatile uint32_t spi2TxnCount;
+extern volatile uint32_t spi2TxnOverrun;
+#endif
+
+void DMM_Spi2SyncEdge(void);
+void DMM_Spi2Drain(void);
+
+//***********************************************************************************
+// GPIOB DMA capture engine
+
+#define DMA_SAMPLE_RING_SIZE	512			// GPIOB->IDR half-word samples, power of two (~9ms of O2 at 55kHz)
+#define DMA_O2_IC_FILTER		0x3			// TI4 filter fCK_INT N=8 (~110ns) - O2 glitch rejection, also delays the snapshot past the edge
+
+extern DMA_HandleTypeDef hdma_tim3_ch3;
+extern uint16_t o2SampleRing[DMA_SAMPLE_RING_SIZE];
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+extern volatile uint32_t o2DmaHalfCount;
+extern volatile uint16_t o2BatchMax;
+#endif
+
+void DMM_DmaDrain(void);
+
 
 #endif // TIMER_H
 
@@ -0,0 +1,473 @@
+/**
+  ******************************************************************************
+  * @file    aadigits.c
+  * @brief   This file provides the anti-aliased MAIN digits drawn by the
+  *          graphics mode renderer (MAIN_AA_DIGITS in display.h).
+  ******************************************************************************
+  * One 68x128 cell per glyph (MAIN_CHAR_PITCH x MAIN_CHAR_HEIGHT, upright), 16
+  * coverage levels, run-length coded in the order the pixels are streamed to the
+  * LT7680: cell column by column (canvas Y), each column top to bottom (canvas X).
+  *   00nnnnnn  background, n + 1 pixels
+  *   01nnnnnn  foreground, n + 1 pixels
+  *   1aaaaann  coverage a (1..14), n + 1 pixels
+  * Rasterised from DejaVu Sans Mono Bold at 136 px, narrowed to 64 wide.
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "aadigits.h"
+
+
+// Character code of each glyph below, in the same order
+const char aaDigitCodes[AA_DIGIT_GLYPHS + 1] = "0123456789+-.,:";
+
+// Start of each glyph in aaDigitRle[], the last entry is the end of the table
+const uint16_t aaDigitOffset[AA_DIGIT_GLYPHS + 1] = {
+	0, 627, 958, 1505, 2120, 2580, 3119, 3756, 4192, 4877, 5511, 5830, 6076, 6259, 6488, 6735
+};
+
+
+const uint8_t aaDigitRle[AA_DIGIT_RLE_BYTES] = {
+	// '0'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x2F, 0x84, 0x8C, 0x90,
+	0x94, 0x98, 0x9D, 0xA0, 0xA6, 0xAB, 0xAA, 0xA6, 0xA0, 0x9D, 0x98, 0x94, 0x90, 0x8C, 0x88, 0x3F,
+	0x1A, 0x88, 0x90, 0x98, 0xA0, 0xA8, 0xB0, 0xB8, 0x5E, 0xB8, 0xB0, 0xA8, 0xA0, 0x98, 0x90, 0x88,
+	0x3F, 0x0D, 0x88, 0x94, 0xA4, 0xAC, 0xB8, 0x6C, 0xB8, 0xB0, 0xA4, 0x94, 0x88, 0x3F, 0x04, 0x88,
+	0x98, 0xA8, 0xB8, 0x76, 0xB8, 0xA8, 0x98, 0x88, 0x3D, 0x88, 0x9C, 0xB0, 0x7E, 0xB0, 0x9C, 0x88,
+	0x37, 0x88, 0x9C, 0xB0, 0x7F, 0x44, 0xB0, 0x9C, 0x88, 0x32, 0x88, 0xA8, 0x7F, 0x4A, 0xA8, 0x88,
+	0x2E, 0x84, 0xA4, 0x7F, 0x4E, 0xA4, 0x84, 0x2B, 0x94, 0xB8, 0x7F, 0x50, 0xB8, 0x94, 0x28, 0x84,
+	0xA8, 0x7F, 0x54, 0xA8, 0x84, 0x25, 0x88, 0xB0, 0x7F, 0x56, 0xB0, 0x88, 0x23, 0x88, 0xB4, 0x7F,
+	0x58, 0xB4, 0x88, 0x21, 0x84, 0xB4, 0x7F, 0x5A, 0xB4, 0x84, 0x1F, 0x84, 0xB0, 0x7F, 0x5C, 0xB0,
+	0x84, 0x1E, 0xA8, 0x7F, 0x5E, 0xA8, 0x1D, 0x90, 0x65, 0xB8, 0xB5, 0xB1, 0xAF, 0xAF, 0xAE, 0xB1,
+	0xB5, 0xB8, 0x65, 0x90, 0x1C, 0xB0, 0x5B, 0xB0, 0xA8, 0xA4, 0x9C, 0x94, 0x90, 0x8C, 0x88, 0x84,
+	0x16, 0x84, 0x88, 0x8C, 0x90, 0x94, 0x9C, 0xA4, 0xA8, 0xB0, 0x5B, 0xB0, 0x1B, 0x94, 0x57, 0xB0,
+	0xA0, 0x94, 0x88, 0x2A, 0x88, 0x94, 0xA0, 0xAC, 0x57, 0x94, 0x1A, 0xAC, 0x54, 0xA8, 0x94, 0x84,
+	0x32, 0x84, 0x94, 0xA8, 0xB8, 0x53, 0xAC, 0x19, 0x84, 0x52, 0xB8, 0x9C, 0x84, 0x18, 0x84, 0x90,
+	0x98, 0x9C, 0x98, 0x90, 0x84, 0x18, 0x84, 0x9C, 0xB8, 0x52, 0x84, 0x18, 0x94, 0x51, 0xA8, 0x84,
+	0x18, 0x8C, 0xA8, 0x46, 0xA8, 0x8C, 0x18, 0x84, 0xA8, 0x51, 0x94, 0x18, 0xA4, 0x50, 0x9C, 0x19,
+	0xA0, 0x4A, 0xA0, 0x19, 0x9C, 0x50, 0xA4, 0x18, 0xAC, 0x4F, 0xA0, 0x19, 0xA4, 0x4C, 0xA4, 0x19,
+	0xA0, 0x4F, 0xAC, 0x18, 0xB4, 0x4E, 0xB8, 0x84, 0x18, 0x8C, 0x4E, 0x8C, 0x18, 0x84, 0xB8, 0x4E,
+	0xB4, 0x18, 0xB8, 0x4E, 0xA8, 0x19, 0xA0, 0x4E, 0xA0, 0x19, 0xA8, 0x4E, 0xB8, 0x18, 0x4F, 0xA0,
+	0x19, 0xAC, 0x4E, 0xAC, 0x19, 0xA0, 0x4F, 0x18, 0x4F, 0xA0, 0x19, 0xAC, 0x4E, 0xAC, 0x19, 0xA0,
+	0x4F, 0x18, 0xB8, 0x4E, 0xAC, 0x19, 0xA0, 0x4E, 0xA0, 0x19, 0xAC, 0x4E, 0xB8, 0x18, 0xB4, 0x4F,
+	0x84, 0x18, 0x88, 0x4E, 0x88, 0x18, 0x84, 0x4F, 0xB4, 0x18, 0xAC, 0x4F, 0xA8, 0x19, 0x98, 0x4C,
+	0x98, 0x19, 0xA8, 0x4F, 0xAC, 0x18, 0xA0, 0x50, 0xA8, 0x19, 0x94, 0xB8, 0x48, 0xB8, 0x94, 0x19,
+	0xA8, 0x50, 0xA0, 0x18, 0x90, 0x51, 0xB0, 0x88, 0x18, 0x88, 0xA4, 0xB8, 0x44, 0xB8, 0xA4, 0x88,
+	0x18, 0x88, 0xB0, 0x51, 0x90, 0x18, 0x84, 0xB8, 0x52, 0xA4, 0x88, 0x19, 0x8C, 0x96, 0x8C, 0x19,
+	0x88, 0xA4, 0x52, 0xB8, 0x84, 0x19, 0xA8, 0x54, 0xAC, 0x98, 0x88, 0x32, 0x88, 0x98, 0xAC, 0x54,
+	0xA8, 0x1A, 0x90, 0x57, 0xB4, 0xA8, 0x98, 0x90, 0x84, 0x28, 0x84, 0x90, 0x98, 0xA4, 0xB4, 0x57,
+	0x90, 0x1B, 0xB0, 0x5B, 0xB8, 0xB0, 0xA8, 0xA0, 0x9C, 0x94, 0x90, 0x8C, 0x88, 0x85, 0x13, 0x84,
+	0x88, 0x8C, 0x90, 0x94, 0x9C, 0xA0, 0xA8, 0xB0, 0xB8, 0x5B, 0xB0, 0x1C, 0x90, 0x67, 0xB9, 0xB6,
+	0xB3, 0xB2, 0xB6, 0xB9, 0x67, 0x90, 0x1D, 0xA0, 0x7F, 0x5E, 0xA0, 0x1F, 0xAC, 0x7F, 0x5C, 0xAC,
+	0x20, 0x84, 0xB0, 0x7F, 0x5A, 0xB0, 0x84, 0x21, 0x84, 0xB0, 0x7F, 0x58, 0xB0, 0x84, 0x23, 0x84,
+	0xAC, 0x7F, 0x56, 0xAC, 0x84, 0x26, 0xA0, 0x7F, 0x54, 0xA0, 0x29, 0x90, 0xB4, 0x7F, 0x50, 0xB4,
+	0x90, 0x2B, 0x84, 0xA0, 0xB8, 0x7F, 0x4C, 0xB8, 0xA0, 0x84, 0x2E, 0x84, 0x9C, 0xB4, 0x7F, 0x48,
+	0xB4, 0x9C, 0x84, 0x33, 0x90, 0xA8, 0x7F, 0x44, 0xA8, 0x90, 0x38, 0x84, 0x98, 0xAC, 0x7E, 0xAC,
+	0x98, 0x84, 0x3D, 0x84, 0x94, 0xA4, 0xB0, 0x76, 0xB0, 0xA4, 0x94, 0x84, 0x3F, 0x04, 0x84, 0x90,
+	0x9C, 0xA8, 0xB4, 0x6C, 0xB4, 0xA8, 0x9C, 0x90, 0x84, 0x3F, 0x0D, 0x84, 0x8C, 0x94, 0x9C, 0xA4,
+	0xAC, 0xB0, 0xB8, 0x5C, 0xB8, 0xB0, 0xAC, 0xA4, 0x9C, 0x94, 0x8C, 0x84, 0x3F, 0x1B, 0x84, 0x88,
+	0x8C, 0x90, 0x94, 0x99, 0x9D, 0xA3, 0xA4, 0xA3, 0x9E, 0x98, 0x94, 0x90, 0x8D, 0x84, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x33,
+	// '1'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x1D, 0x84, 0x8F, 0x8F, 0x8F, 0x8F, 0x8C, 0x3F, 0x2D, 0x90, 0x50, 0x20, 0x98,
+	0x50, 0x94, 0x39, 0x90, 0x50, 0x20, 0xAC, 0x4F, 0xB8, 0x3A, 0x90, 0x50, 0x1F, 0x84, 0x50, 0xA8,
+	0x3A, 0x90, 0x50, 0x1F, 0x98, 0x50, 0x94, 0x3A, 0x90, 0x50, 0x1F, 0xA8, 0x4F, 0xB8, 0x84, 0x3A,
+	0x90, 0x50, 0x1F, 0xB8, 0x4F, 0xA8, 0x3B, 0x90, 0x50, 0x1E, 0x90, 0x50, 0x94, 0x3B, 0x90, 0x50,
+	0x1E, 0xA4, 0x50, 0x84, 0x3B, 0x90, 0x50, 0x1E, 0xB8, 0x4F, 0xA8, 0x3C, 0x90, 0x50, 0x1D, 0x90,
+	0x50, 0x94, 0x3C, 0x90, 0x50, 0x1D, 0xA4, 0x4F, 0xB8, 0x84, 0x3C, 0x90, 0x50, 0x1D, 0xB4, 0x4F,
+	0xA8, 0x3D, 0x90, 0x50, 0x1C, 0x8C, 0x50, 0x94, 0x3D, 0x90, 0x50, 0x1C, 0x9C, 0x50, 0x84, 0x3D,
+	0x90, 0x50, 0x1C, 0xB0, 0x4F, 0xAC, 0x3E, 0x90, 0x50, 0x1B, 0x84, 0x50, 0x9C, 0x87, 0x87, 0x87,
+	0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x94, 0x50, 0x1B,
+	0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B,
+	0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B,
+	0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B,
+	0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x8C, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+	0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAC, 0xB0, 0x50,
+	0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50,
+	0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50,
+	0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50,
+	0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50,
+	0x3F, 0x2D, 0x8C, 0xB7, 0xB7, 0xB7, 0xB7, 0xB4, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+	// '2'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1E, 0x87, 0x87, 0x87, 0x87,
+	0x84, 0x3F, 0x2D, 0xA0, 0x50, 0x1F, 0x94, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x88, 0x38, 0x84, 0xAC,
+	0x51, 0x1E, 0x88, 0x50, 0xB4, 0x84, 0x37, 0x90, 0xB8, 0x52, 0x1E, 0xA4, 0x50, 0x90, 0x37, 0x9C,
+	0x54, 0x1D, 0x84, 0xB8, 0x4F, 0xA4, 0x36, 0x84, 0xAC, 0x55, 0x1D, 0x98, 0x4F, 0xB4, 0x84, 0x35,
+	0x94, 0xB8, 0x56, 0x1D, 0xB0, 0x4F, 0x94, 0x34, 0x84, 0xA8, 0x58, 0x1C, 0x88, 0x4F, 0xB0, 0x34,
+	0x8C, 0xB4, 0x59, 0x1C, 0x9C, 0x4F, 0x90, 0x33, 0x98, 0x5B, 0x1C, 0xB0, 0x4E, 0xB0, 0x32, 0x84,
+	0xA8, 0x5C, 0x1B, 0x88, 0x4F, 0x94, 0x31, 0x8C, 0xB4, 0x5D, 0x1B, 0x98, 0x4E, 0xB4, 0x31, 0x98,
+	0x5F, 0x1B, 0xA8, 0x4E, 0x9C, 0x2F, 0x84, 0xA8, 0x60, 0x1B, 0xB4, 0x4E, 0x88, 0x2E, 0x94, 0xB4,
+	0x61, 0x1A, 0x88, 0x4E, 0xAC, 0x2D, 0x84, 0xA4, 0x63, 0x1A, 0x94, 0x4E, 0x98, 0x2C, 0x88, 0xB0,
+	0x64, 0x1A, 0x9C, 0x4E, 0x88, 0x2B, 0x98, 0xB8, 0x53, 0xB0, 0x50, 0x1A, 0xA8, 0x4D, 0xB8, 0x2A,
+	0x84, 0xA4, 0x54, 0x9C, 0x90, 0x50, 0x1A, 0xAC, 0x4D, 0xAC, 0x29, 0x8C, 0xB4, 0x53, 0xB8, 0x90,
+	0x00, 0x90, 0x50, 0x1A, 0xB4, 0x4D, 0xA4, 0x28, 0x98, 0xB8, 0x53, 0xB0, 0x88, 0x01, 0x90, 0x50,
+	0x1A, 0xB8, 0x4D, 0xA0, 0x26, 0x84, 0xA8, 0x54, 0xA4, 0x03, 0x90, 0x50, 0x1A, 0x4E, 0xA0, 0x25,
+	0x94, 0xB4, 0x53, 0xB8, 0x94, 0x04, 0x90, 0x50, 0x1A, 0x4E, 0xA0, 0x23, 0x84, 0xA4, 0x54, 0xB0,
+	0x88, 0x05, 0x90, 0x50, 0x1A, 0x4E, 0xA8, 0x22, 0x8C, 0xB4, 0x54, 0xA4, 0x07, 0x90, 0x50, 0x1A,
+	0xB8, 0x4D, 0xB0, 0x21, 0x98, 0x55, 0x98, 0x08, 0x90, 0x50, 0x1A, 0xB4, 0x4E, 0x84, 0x1E, 0x84,
+	0xAC, 0x54, 0xB4, 0x8C, 0x09, 0x90, 0x50, 0x1A, 0xB0, 0x4E, 0x98, 0x1D, 0x94, 0xB8, 0x54, 0xB0,
+	0x84, 0x0A, 0x90, 0x50, 0x1A, 0xA8, 0x4E, 0xB0, 0x1B, 0x84, 0xA8, 0x55, 0xA4, 0x0C, 0x90, 0x50,
+	0x1A, 0xA0, 0x4F, 0x98, 0x19, 0x94, 0xB8, 0x55, 0x98, 0x0D, 0x90, 0x50, 0x1A, 0x94, 0x50, 0x94,
+	0x16, 0x94, 0xB0, 0x55, 0xB0, 0x8C, 0x0E, 0x90, 0x50, 0x1A, 0x84, 0x51, 0x9C, 0x13, 0x94, 0xB4,
+	0x56, 0xA4, 0x10, 0x90, 0x50, 0x1B, 0xB4, 0x51, 0xAC, 0x88, 0x0E, 0x84, 0x9C, 0xB4, 0x56, 0xB8,
+	0x94, 0x11, 0x90, 0x50, 0x1B, 0xA0, 0x53, 0xA8, 0x94, 0x84, 0x08, 0x88, 0x98, 0xA8, 0x58, 0xB4,
+	0x8C, 0x12, 0x90, 0x50, 0x1B, 0x8C, 0x56, 0xB4, 0xA8, 0xA4, 0xA2, 0xA4, 0xAC, 0xB8, 0x5A, 0xAC,
+	0x84, 0x13, 0x90, 0x50, 0x1C, 0xB0, 0x78, 0x9C, 0x15, 0x90, 0x50, 0x1C, 0x94, 0x76, 0xB8, 0x90,
+	0x16, 0x90, 0x50, 0x1D, 0xB4, 0x74, 0xB0, 0x88, 0x17, 0x90, 0x50, 0x1D, 0x90, 0x72, 0xB8, 0x9C,
+	0x19, 0x90, 0x50, 0x1E, 0xA0, 0x70, 0xB0, 0x88, 0x1A, 0x90, 0x50, 0x1F, 0xB0, 0x6E, 0xA4, 0x84,
+	0x1B, 0x90, 0x50, 0x1F, 0x88, 0xB4, 0x6B, 0xB8, 0x94, 0x1D, 0x90, 0x50, 0x20, 0x8C, 0xB8, 0x69,
+	0xA8, 0x84, 0x1E, 0x90, 0x50, 0x21, 0x8C, 0xB4, 0x66, 0xB4, 0x94, 0x20, 0x90, 0x50, 0x22, 0x88,
+	0xB0, 0x63, 0xB8, 0xA0, 0x84, 0x21, 0x90, 0x50, 0x24, 0xA0, 0x61, 0xA4, 0x88, 0x23, 0x90, 0x50,
+	0x25, 0x8C, 0xA8, 0x5C, 0xB4, 0x9C, 0x88, 0x25, 0x90, 0x50, 0x27, 0x88, 0xA0, 0xB8, 0x56, 0xB8,
+	0xA8, 0x90, 0x28, 0x90, 0x50, 0x2A, 0x94, 0xA8, 0xB8, 0x50, 0xB4, 0xA8, 0x94, 0x84, 0x2A, 0x90,
+	0x50, 0x2D, 0x88, 0x94, 0xA0, 0xA8, 0xB0, 0xB4, 0xBB, 0xB8, 0xB4, 0xAC, 0xA8, 0xA0, 0x94, 0x88,
+	0x2E, 0x90, 0x50, 0x3F, 0x2E, 0x87, 0x87, 0x87, 0x87, 0x84, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x0F,
+	// '3'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x19, 0x84, 0xA3,
+	0xA3, 0xA3, 0xA3, 0xA1, 0x84, 0x3F, 0x2C, 0xA4, 0x50, 0x9C, 0x20, 0x88, 0x8F, 0x8F, 0x8F, 0x8F,
+	0x88, 0x39, 0x84, 0xB8, 0x4F, 0xB4, 0x1F, 0x84, 0xB8, 0x4F, 0xA8, 0x3A, 0x9C, 0x50, 0x90, 0x1E,
+	0x94, 0x50, 0x8C, 0x3A, 0x84, 0xB8, 0x4F, 0xA8, 0x1E, 0xAC, 0x4F, 0xAC, 0x3C, 0x9C, 0x50, 0x84,
+	0x1C, 0x84, 0x50, 0x90, 0x3C, 0x84, 0xB8, 0x4F, 0x98, 0x1C, 0x98, 0x4F, 0xB4, 0x3E, 0xA4, 0x4F,
+	0xAC, 0x1C, 0xA8, 0x4F, 0x9C, 0x3E, 0x8C, 0x50, 0x84, 0x1B, 0xB8, 0x4F, 0x84, 0x3F, 0xB4, 0x4F,
+	0x90, 0x1A, 0x8C, 0x4F, 0xAC, 0x3F, 0x00, 0xA4, 0x4F, 0xA0, 0x1A, 0x9C, 0x4F, 0x98, 0x3F, 0x00,
+	0x90, 0x4F, 0xAC, 0x1A, 0xA8, 0x4F, 0x88, 0x3F, 0x00, 0x84, 0x4F, 0xB8, 0x1A, 0xB8, 0x4E, 0xB0,
+	0x3F, 0x02, 0xAC, 0x4F, 0x88, 0x18, 0x88, 0x4F, 0xA0, 0x14, 0xA4, 0xB3, 0xB3, 0xB3, 0xB3, 0x98,
+	0x1B, 0xA0, 0x4F, 0x94, 0x18, 0x94, 0x4F, 0x94, 0x14, 0xAC, 0x4F, 0xA0, 0x1B, 0x94, 0x4F, 0x9C,
+	0x18, 0x9C, 0x4F, 0x88, 0x14, 0xAC, 0x4F, 0xA0, 0x1B, 0x8C, 0x4F, 0xA4, 0x18, 0xA4, 0x4E, 0xB8,
+	0x15, 0xAC, 0x4F, 0xA0, 0x1B, 0x84, 0x4F, 0xAC, 0x18, 0xAC, 0x4E, 0xB0, 0x15, 0xAC, 0x4F, 0xA0,
+	0x1C, 0xB8, 0x4E, 0xB0, 0x18, 0xB0, 0x4E, 0xA8, 0x15, 0xAC, 0x4F, 0xA0, 0x1C, 0xB4, 0x4E, 0xB4,
+	0x18, 0xB8, 0x4E, 0xA4, 0x15, 0xAC, 0x4F, 0xA0, 0x1C, 0xB0, 0x4E, 0xB8, 0x18, 0xB8, 0x4E, 0xA0,
+	0x15, 0xAC, 0x4F, 0xA0, 0x1C, 0xB0, 0x4F, 0x18, 0x4F, 0xA0, 0x15, 0xAC, 0x4F, 0xA0, 0x1C, 0xAC,
+	0x4F, 0x18, 0x4F, 0xA0, 0x15, 0xB0, 0x4F, 0xA0, 0x1C, 0xB0, 0x4F, 0x18, 0x4F, 0xA4, 0x15, 0xB4,
+	0x4F, 0xA4, 0x1C, 0xB0, 0x4F, 0x18, 0xB8, 0x4E, 0xB0, 0x15, 0x50, 0xAC, 0x1C, 0xB8, 0x4E, 0xB8,
+	0x18, 0xB4, 0x4E, 0xB8, 0x14, 0x8C, 0x50, 0xB8, 0x1B, 0x88, 0x4F, 0xB4, 0x18, 0xB0, 0x4F, 0x90,
+	0x13, 0x9C, 0x51, 0x90, 0x1A, 0x98, 0x4F, 0xAC, 0x18, 0xA8, 0x4F, 0xA8, 0x13, 0xB0, 0x51, 0xA4,
+	0x1A, 0xA8, 0x4F, 0xA8, 0x18, 0x9C, 0x50, 0x90, 0x11, 0x98, 0x53, 0x88, 0x18, 0x8C, 0x50, 0x9C,
+	0x18, 0x90, 0x50, 0xB4, 0x84, 0x0F, 0x88, 0xB8, 0x53, 0xAC, 0x18, 0xAC, 0x50, 0x90, 0x18, 0x84,
+	0x51, 0xB0, 0x84, 0x0D, 0x84, 0xB4, 0x55, 0xA0, 0x16, 0x9C, 0x51, 0x84, 0x19, 0xB0, 0x51, 0xB4,
+	0x90, 0x0B, 0x8C, 0xB4, 0x57, 0x9C, 0x14, 0x94, 0x51, 0xB4, 0x1A, 0xA0, 0x53, 0xAC, 0x94, 0x84,
+	0x06, 0x90, 0xA8, 0x5A, 0xA8, 0x84, 0x11, 0x98, 0x52, 0xA4, 0x1A, 0x8C, 0x56, 0xB0, 0xA8, 0xA6,
+	0xAC, 0xB8, 0x4E, 0xAC, 0x4D, 0xB8, 0x98, 0x84, 0x0D, 0x88, 0xA8, 0x53, 0x90, 0x1B, 0xB0, 0x6B,
+	0x90, 0x4F, 0xB8, 0xA4, 0x94, 0x84, 0x07, 0x84, 0x94, 0xA8, 0x54, 0xB4, 0x1C, 0x94, 0x6A, 0xA8,
+	0x00, 0xB4, 0x52, 0xB4, 0xAC, 0xA8, 0xA6, 0xA8, 0xB0, 0x57, 0xA0, 0x1D, 0xB0, 0x69, 0x90, 0x00,
+	0xA0, 0x71, 0xB8, 0x84, 0x1D, 0x8C, 0x68, 0xB0, 0x01, 0x84, 0x71, 0x9C, 0x1F, 0xA0, 0x67, 0x90,
+	0x02, 0xA4, 0x6F, 0xB4, 0x21, 0xAC, 0x65, 0xA8, 0x03, 0x84, 0xB8, 0x6E, 0x8C, 0x21, 0x84, 0xB4,
+	0x63, 0xB4, 0x84, 0x04, 0x98, 0x6D, 0x9C, 0x23, 0x88, 0xB4, 0x61, 0xB8, 0x8C, 0x06, 0xA8, 0x6B,
+	0xA8, 0x25, 0x88, 0xB4, 0x60, 0x90, 0x07, 0x84, 0xB0, 0x69, 0xAC, 0x27, 0x84, 0xA8, 0x5D, 0xB8,
+	0x90, 0x09, 0x84, 0xB0, 0x67, 0xA8, 0x2A, 0x94, 0xB0, 0x5A, 0xA4, 0x84, 0x0B, 0x84, 0xA4, 0x64,
+	0xB8, 0x98, 0x2D, 0x94, 0xB0, 0x56, 0xA8, 0x8C, 0x0F, 0x90, 0xB4, 0x61, 0xA8, 0x88, 0x30, 0x90,
+	0xA4, 0xB8, 0x50, 0xB8, 0xA4, 0x8C, 0x12, 0x84, 0xA0, 0xB8, 0x5D, 0xB0, 0x90, 0x35, 0x8C, 0x9C,
+	0xA8, 0xB0, 0xB8, 0x46, 0xB8, 0xB4, 0xA8, 0x9C, 0x8C, 0x17, 0x84, 0xA0, 0xB8, 0x59, 0xA8, 0x90,
+	0x3C, 0x84, 0x89, 0x8C, 0x89, 0x84, 0x1F, 0x90, 0xA4, 0xB4, 0x52, 0xB8, 0xA8, 0x98, 0x84, 0x3F,
+	0x28, 0x88, 0x94, 0xA0, 0xA8, 0xB0, 0xB4, 0xB8, 0x44, 0xB8, 0xB4, 0xB0, 0xA8, 0xA0, 0x94, 0x88,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+	// '4'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x90, 0xAC, 0xB3, 0xB3,
+	0xB3, 0xB3, 0xB1, 0x98, 0x3F, 0x28, 0x90, 0xAC, 0x53, 0xA0, 0x3F, 0x26, 0x8C, 0xAC, 0x55, 0xA0,
+	0x3F, 0x24, 0x8C, 0xAC, 0x57, 0xA0, 0x3F, 0x22, 0x8C, 0xA8, 0x59, 0xA0, 0x3F, 0x20, 0x88, 0xA8,
+	0x5B, 0xA0, 0x3F, 0x1E, 0x90, 0xA8, 0x5D, 0xA0, 0x3F, 0x1C, 0x94, 0xB0, 0x5F, 0xA0, 0x3F, 0x1A,
+	0x90, 0xB0, 0x61, 0xA0, 0x3F, 0x18, 0x90, 0xAC, 0x63, 0xA0, 0x3F, 0x16, 0x8C, 0xAC, 0x65, 0xA0,
+	0x3F, 0x14, 0x8C, 0xAC, 0x56, 0xAC, 0x4F, 0xA0, 0x3F, 0x12, 0x8C, 0xA8, 0x56, 0xA4, 0x88, 0x90,
+	0x4F, 0xA0, 0x3F, 0x10, 0x8C, 0xA8, 0x56, 0xA4, 0x88, 0x01, 0x90, 0x4F, 0xA0, 0x3F, 0x0E, 0x90,
+	0xAC, 0x55, 0xB8, 0xA0, 0x88, 0x03, 0x90, 0x4F, 0xA0, 0x3F, 0x0C, 0x94, 0xB0, 0x55, 0xB8, 0x9C,
+	0x84, 0x05, 0x90, 0x4F, 0xA0, 0x3F, 0x0A, 0x90, 0xB0, 0x55, 0xB8, 0x9C, 0x84, 0x07, 0x90, 0x4F,
+	0xA0, 0x3F, 0x08, 0x90, 0xB0, 0x55, 0xB8, 0x9C, 0x84, 0x09, 0x90, 0x4F, 0xA0, 0x3F, 0x06, 0x90,
+	0xAC, 0x55, 0xB8, 0xA0, 0x84, 0x0B, 0x90, 0x4F, 0xA0, 0x3F, 0x04, 0x8C, 0xAC, 0x55, 0xB8, 0xA0,
+	0x84, 0x0D, 0x90, 0x4F, 0xA0, 0x3F, 0x02, 0x8C, 0xAC, 0x56, 0xA0, 0x84, 0x0F, 0x90, 0x4F, 0xA0,
+	0x3F, 0x00, 0x8C, 0xA8, 0x56, 0xA4, 0x88, 0x11, 0x90, 0x4F, 0xA0, 0x3E, 0x90, 0xAC, 0x55, 0xB8,
+	0xA0, 0x88, 0x13, 0x90, 0x4F, 0xA0, 0x3C, 0x94, 0xB0, 0x55, 0xB8, 0x98, 0x16, 0x90, 0x4F, 0xA0,
+	0x3A, 0x94, 0xB0, 0x55, 0xB8, 0x9C, 0x84, 0x17, 0x90, 0x4F, 0xA0, 0x38, 0x90, 0xB0, 0x55, 0xB8,
+	0x9C, 0x84, 0x19, 0x90, 0x4F, 0xA0, 0x36, 0x90, 0xB0, 0x55, 0xB8, 0x9C, 0x84, 0x1B, 0x90, 0x4F,
+	0xA0, 0x34, 0x8C, 0xAC, 0x55, 0xB8, 0xA0, 0x84, 0x1D, 0x90, 0x4F, 0xA0, 0x32, 0x8C, 0xAC, 0x55,
+	0xB8, 0xA0, 0x84, 0x1F, 0x90, 0x4F, 0xA0, 0x30, 0x84, 0xA8, 0x56, 0xA0, 0x84, 0x21, 0x90, 0x4F,
+	0xA0, 0x30, 0x90, 0x54, 0xB8, 0xA4, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+	0x94, 0x4F, 0xA0, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x88, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F,
+	0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F,
+	0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F,
+	0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F, 0x62, 0x1B, 0x90, 0x7F,
+	0x62, 0x1B, 0x8C, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+	0xAF, 0xAF, 0xB0, 0x4F, 0xB4, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAC, 0x3F, 0x18, 0x90, 0x4F, 0xA0,
+	0x3F, 0x2D, 0x90, 0x4F, 0xA0, 0x3F, 0x2D, 0x90, 0x4F, 0xA0, 0x3F, 0x2D, 0x90, 0x4F, 0xA0, 0x3F,
+	0x2D, 0x90, 0x4F, 0xA0, 0x3F, 0x2D, 0x90, 0x4F, 0xA0, 0x3F, 0x2D, 0x90, 0x4F, 0xA0, 0x3F, 0x2D,
+	0x90, 0x4F, 0xA0, 0x3F, 0x2D, 0x84, 0x8F, 0x8F, 0x8F, 0x8F, 0x84, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24,
+	// '5'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1B,
+	0x9C, 0xA7, 0xA7, 0xA7, 0xA7, 0xA0, 0x3F, 0x2D, 0x94, 0x50, 0x8C, 0x3F, 0x2D, 0xB0, 0x4F, 0xA0,
+	0x1C, 0x90, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9,
+	0xB4, 0x84, 0x17, 0x90, 0x4F, 0xB4, 0x1C, 0x90, 0x75, 0x94, 0x19, 0xAC, 0x4F, 0x90, 0x1B, 0x90,
+	0x74, 0xAC, 0x1A, 0x8C, 0x4F, 0xA4, 0x1B, 0x90, 0x74, 0x90, 0x1B, 0xB0, 0x4E, 0xB4, 0x1B, 0x90,
+	0x73, 0xB0, 0x1C, 0x9C, 0x4F, 0x88, 0x1A, 0x90, 0x73, 0x94, 0x1C, 0x88, 0x4F, 0x98, 0x1A, 0x90,
+	0x72, 0xB8, 0x1E, 0xB0, 0x4E, 0xA8, 0x1A, 0x90, 0x72, 0xA4, 0x1E, 0xA0, 0x4E, 0xB4, 0x1A, 0x90,
+	0x72, 0x90, 0x1E, 0x90, 0x4F, 0x84, 0x19, 0x90, 0x71, 0xB8, 0x1F, 0x84, 0x4F, 0x90, 0x19, 0x90,
+	0x71, 0xA8, 0x20, 0xB4, 0x4E, 0x9C, 0x19, 0x90, 0x71, 0x9C, 0x20, 0xAC, 0x4E, 0xA4, 0x19, 0x90,
+	0x50, 0x97, 0x97, 0x97, 0x97, 0x95, 0xAC, 0x4D, 0x94, 0x20, 0xA8, 0x4E, 0xAC, 0x19, 0x90, 0x50,
+	0x11, 0xB8, 0x4D, 0x8C, 0x20, 0xA0, 0x4E, 0xB0, 0x19, 0x90, 0x50, 0x10, 0x94, 0x4E, 0x84, 0x20,
+	0xA0, 0x4E, 0xB4, 0x19, 0x90, 0x50, 0x10, 0xA4, 0x4E, 0x21, 0xA0, 0x4E, 0xB8, 0x19, 0x90, 0x50,
+	0x10, 0xB0, 0x4E, 0x21, 0xA0, 0x4F, 0x19, 0x90, 0x50, 0x10, 0x4F, 0x21, 0xA4, 0x4F, 0x19, 0x90,
+	0x50, 0x0F, 0x88, 0x4F, 0x88, 0x20, 0xAC, 0x4F, 0x19, 0x90, 0x50, 0x0F, 0x8C, 0x4F, 0x90, 0x20,
+	0xB4, 0x4E, 0xB8, 0x19, 0x90, 0x50, 0x0F, 0x90, 0x4F, 0x9C, 0x1F, 0x84, 0x4F, 0xB4, 0x19, 0x90,
+	0x50, 0x0F, 0x90, 0x4F, 0xAC, 0x1F, 0x94, 0x4F, 0xB0, 0x19, 0x90, 0x50, 0x0F, 0x8C, 0x50, 0x84,
+	0x1E, 0xA4, 0x4F, 0xA8, 0x19, 0x90, 0x50, 0x0F, 0x88, 0x50, 0x9C, 0x1D, 0x84, 0xB8, 0x4F, 0xA0,
+	0x19, 0x90, 0x50, 0x10, 0x50, 0xB8, 0x84, 0x1C, 0x9C, 0x50, 0x98, 0x19, 0x90, 0x50, 0x10, 0xB4,
+	0x50, 0xAC, 0x1B, 0x8C, 0xB8, 0x50, 0x88, 0x19, 0x90, 0x50, 0x10, 0xA4, 0x51, 0xA4, 0x19, 0x84,
+	0xB4, 0x50, 0xB4, 0x1A, 0x90, 0x50, 0x10, 0x94, 0x52, 0xA4, 0x17, 0x84, 0xB0, 0x51, 0xA0, 0x1A,
+	0x90, 0x50, 0x10, 0x84, 0x53, 0xAC, 0x84, 0x14, 0x8C, 0xB4, 0x52, 0x8C, 0x1A, 0x90, 0x50, 0x11,
+	0xAC, 0x53, 0xB8, 0x98, 0x11, 0x84, 0x9C, 0x53, 0xB4, 0x1B, 0x90, 0x50, 0x11, 0x94, 0x55, 0xB4,
+	0x9C, 0x88, 0x0C, 0x8C, 0xA0, 0xB8, 0x54, 0x98, 0x1B, 0x90, 0x50, 0x12, 0xB0, 0x57, 0xB0, 0xA4,
+	0x98, 0x90, 0x8C, 0x8A, 0x8C, 0x94, 0x9C, 0xA8, 0xB4, 0x56, 0xB4, 0x84, 0x1B, 0x90, 0x50, 0x12,
+	0x94, 0x7B, 0x98, 0x1C, 0x90, 0x50, 0x13, 0xA8, 0x79, 0xAC, 0x1D, 0x90, 0x50, 0x13, 0x84, 0xB4,
+	0x77, 0xB8, 0x84, 0x1D, 0x90, 0x50, 0x14, 0x8C, 0xB8, 0x76, 0x90, 0x1E, 0x90, 0x50, 0x15, 0x90,
+	0x75, 0x98, 0x1F, 0x90, 0x50, 0x16, 0x94, 0x73, 0x9C, 0x20, 0x90, 0x50, 0x17, 0x90, 0xB8, 0x70,
+	0x9C, 0x21, 0x90, 0x50, 0x18, 0x8C, 0xB4, 0x6D, 0xB8, 0x94, 0x22, 0x90, 0x50, 0x19, 0x84, 0xA8,
+	0x6B, 0xB4, 0x8C, 0x23, 0x90, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x1B, 0x90, 0xB0, 0x67, 0xB8, 0x9C,
+	0x3F, 0x15, 0x90, 0xB0, 0x63, 0xB8, 0xA0, 0x84, 0x3F, 0x18, 0x90, 0xAC, 0x5F, 0xB4, 0x9C, 0x84,
+	0x3F, 0x1C, 0x88, 0x9C, 0xB0, 0x59, 0xB8, 0xA8, 0x90, 0x3F, 0x22, 0x84, 0x94, 0xA4, 0xB0, 0x51,
+	0xB8, 0xAC, 0x9C, 0x90, 0x3F, 0x2A, 0x88, 0x94, 0x98, 0xA0, 0xA4, 0xA9, 0xAD, 0xA9, 0xA4, 0xA0,
+	0x9C, 0x94, 0x90, 0x84, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26,
+	// '6'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x36, 0x84, 0x89, 0x8F,
+	0x91, 0x8F, 0x89, 0x85, 0x3F, 0x24, 0x88, 0x90, 0x98, 0xA0, 0xA4, 0xAC, 0xB0, 0xB4, 0xB8, 0x52,
+	0xB8, 0xB4, 0xB0, 0xAC, 0xA8, 0xA0, 0x9C, 0x94, 0x90, 0x88, 0x3F, 0x13, 0x84, 0x94, 0x9C, 0xA8,
+	0xB4, 0x67, 0xB0, 0xA8, 0xA0, 0x94, 0x88, 0x3F, 0x09, 0x88, 0x94, 0xA4, 0xB4, 0x71, 0xB8, 0xAC,
+	0x9C, 0x8C, 0x3F, 0x02, 0x88, 0x9C, 0xB0, 0x79, 0xB8, 0xA8, 0x94, 0x84, 0x3B, 0x8C, 0xA0, 0xB0,
+	0x7F, 0x40, 0xA8, 0x98, 0x84, 0x36, 0x90, 0xAC, 0x7F, 0x45, 0xB8, 0xA4, 0x88, 0x32, 0x90, 0xB0,
+	0x7F, 0x49, 0xB8, 0xA0, 0x84, 0x2E, 0x84, 0xA8, 0x7F, 0x4D, 0xB4, 0x90, 0x2C, 0x94, 0xB8, 0x7F,
+	0x50, 0xA0, 0x2A, 0xA4, 0x7F, 0x53, 0xA8, 0x84, 0x26, 0x84, 0xAC, 0x7F, 0x55, 0xAC, 0x84, 0x24,
+	0x84, 0xB0, 0x7F, 0x57, 0xA8, 0x23, 0x88, 0xB4, 0x7F, 0x59, 0xA4, 0x21, 0x84, 0xB4, 0x7F, 0x5B,
+	0x94, 0x20, 0xAC, 0x5B, 0xB4, 0xAC, 0xA4, 0x9C, 0x94, 0x90, 0x8C, 0x89, 0xA4, 0x76, 0xB8, 0x84,
+	0x1E, 0x98, 0x57, 0xB8, 0xA8, 0x9C, 0x8C, 0x84, 0x06, 0x88, 0xB0, 0x78, 0xA0, 0x1D, 0x84, 0xB8,
+	0x54, 0xB8, 0xA4, 0x90, 0x0A, 0x90, 0xB8, 0x52, 0xB0, 0xA4, 0x9C, 0x94, 0x90, 0x8C, 0x89, 0x84,
+	0x89, 0x8C, 0x90, 0x98, 0xA0, 0xA8, 0xB4, 0x55, 0xB8, 0x84, 0x1C, 0xA4, 0x53, 0xB8, 0x9C, 0x84,
+	0x0B, 0x8C, 0xB8, 0x4F, 0xB8, 0xA4, 0x90, 0x11, 0x88, 0x98, 0xB0, 0x53, 0x98, 0x1B, 0x88, 0x53,
+	0x9C, 0x84, 0x0C, 0x88, 0xB8, 0x4E, 0xB8, 0x9C, 0x84, 0x16, 0x8C, 0xAC, 0x51, 0xAC, 0x1B, 0xA0,
+	0x51, 0xB0, 0x88, 0x0E, 0xAC, 0x4E, 0xAC, 0x84, 0x1A, 0x94, 0xB8, 0x50, 0x84, 0x19, 0x84, 0xB8,
+	0x50, 0xA4, 0x84, 0x0E, 0x98, 0x4E, 0xA0, 0x1D, 0x88, 0xB4, 0x4F, 0x94, 0x19, 0x94, 0x50, 0xA0,
+	0x0F, 0x84, 0xB8, 0x4D, 0xA8, 0x1F, 0x8C, 0x4F, 0xA0, 0x19, 0xA4, 0x4F, 0xAC, 0x10, 0x94, 0x4E,
+	0x88, 0x20, 0xA4, 0x4E, 0xA8, 0x19, 0xB4, 0x4E, 0xB8, 0x88, 0x10, 0xA8, 0x4D, 0xA8, 0x21, 0x8C,
+	0x4E, 0xB0, 0x18, 0x84, 0x4F, 0xA0, 0x11, 0xB8, 0x4D, 0x98, 0x22, 0xB8, 0x4D, 0xB8, 0x18, 0x90,
+	0x4F, 0x84, 0x10, 0x88, 0x4E, 0x90, 0x22, 0xB0, 0x4E, 0x18, 0x98, 0x4E, 0xAC, 0x11, 0x94, 0x4E,
+	0x90, 0x22, 0xAC, 0x4E, 0x18, 0xA0, 0x4E, 0x9C, 0x11, 0x98, 0x4E, 0x94, 0x22, 0xB0, 0x4E, 0x18,
+	0xA8, 0x4E, 0x8C, 0x11, 0x9C, 0x4E, 0xA0, 0x21, 0x84, 0x4E, 0xB8, 0x18, 0xAC, 0x4E, 0x84, 0x11,
+	0x9C, 0x4E, 0xB4, 0x21, 0x94, 0x4E, 0xB4, 0x18, 0xAC, 0x4E, 0x12, 0x9C, 0x4F, 0x94, 0x20, 0xB0,
+	0x4E, 0xAC, 0x18, 0xAC, 0x4E, 0x12, 0x98, 0x4F, 0xB8, 0x84, 0x1E, 0x9C, 0x4F, 0xA0, 0x18, 0xAC,
+	0x4E, 0x84, 0x11, 0x90, 0x50, 0xB0, 0x84, 0x1C, 0x98, 0x50, 0x94, 0x18, 0xA4, 0x4E, 0x88, 0x11,
+	0x88, 0x51, 0xB4, 0x90, 0x19, 0x84, 0xA4, 0x51, 0x88, 0x18, 0xA0, 0x4E, 0x94, 0x12, 0xB8, 0x52,
+	0xA8, 0x8C, 0x15, 0x84, 0x98, 0xB4, 0x51, 0xB0, 0x19, 0x98, 0x4E, 0xA0, 0x12, 0xA8, 0x54, 0xB0,
+	0x9C, 0x8C, 0x0F, 0x84, 0x94, 0xA4, 0xB8, 0x53, 0x98, 0x19, 0x8C, 0x4E, 0xB0, 0x12, 0x90, 0x58,
+	0xB0, 0xA8, 0xA4, 0xA0, 0x9C, 0x9B, 0x98, 0x9C, 0xA0, 0xA8, 0xAC, 0xB4, 0x56, 0xB8, 0x84, 0x1A,
+	0xB8, 0x4E, 0x88, 0x12, 0xB4, 0x7D, 0x98, 0x1B, 0xAC, 0x4E, 0xA0, 0x12, 0x98, 0x7C, 0xB0, 0x1C,
+	0x9C, 0x4E, 0xB8, 0x13, 0xB0, 0x7B, 0x8C, 0x1C, 0x8C, 0x4F, 0x98, 0x12, 0x8C, 0x7A, 0x9C, 0x1E,
+	0xB4, 0x4E, 0xB4, 0x13, 0x98, 0x78, 0xA4, 0x1F, 0x9C, 0x4F, 0x98, 0x13, 0xA4, 0x76, 0xA4, 0x20,
+	0x88, 0x4F, 0xB8, 0x84, 0x13, 0xA4, 0x74, 0xA0, 0x22, 0xA8, 0x4F, 0xA8, 0x14, 0x98, 0xB8, 0x70,
+	0xB4, 0x90, 0x23, 0x88, 0x50, 0x9C, 0x14, 0x88, 0xAC, 0x6E, 0xA0, 0x26, 0x90, 0x97, 0x97, 0x97,
+	0x97, 0x90, 0x16, 0x94, 0xB4, 0x6A, 0xA8, 0x88, 0x3F, 0x12, 0x98, 0xB4, 0x66, 0xA4, 0x8C, 0x3F,
+	0x16, 0x90, 0xA8, 0xB8, 0x60, 0xB0, 0x98, 0x84, 0x3F, 0x1B, 0x90, 0xA0, 0xB0, 0x59, 0xB4, 0xA4,
+	0x98, 0x84, 0x3F, 0x21, 0x84, 0x8C, 0x98, 0xA0, 0xAC, 0xB0, 0xB8, 0x4B, 0xB8, 0xB0, 0xAC, 0xA4,
+	0x98, 0x90, 0x84, 0x3F, 0x2D, 0x84, 0x89, 0x8F, 0x89, 0x84, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x2B,
+	// '7'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0B, 0x90,
+	0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90,
+	0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x2D, 0x90, 0x50, 0x3F, 0x0E, 0x88,
+	0x9C, 0xB0, 0x1B, 0x90, 0x50, 0x3F, 0x0B, 0x8C, 0xA0, 0xB4, 0x42, 0x1B, 0x90, 0x50, 0x3F, 0x08,
+	0x90, 0xA4, 0xB4, 0x45, 0x1B, 0x90, 0x50, 0x3F, 0x04, 0x84, 0x94, 0xA8, 0xB8, 0x48, 0x1B, 0x90,
+	0x50, 0x3F, 0x01, 0x84, 0x98, 0xAC, 0x4C, 0x1B, 0x90, 0x50, 0x3D, 0x84, 0x90, 0xA0, 0xB0, 0x4F,
+	0x1B, 0x90, 0x50, 0x3A, 0x84, 0x98, 0xA8, 0x53, 0x1B, 0x90, 0x50, 0x37, 0x88, 0x9C, 0xAC, 0x56,
+	0x1B, 0x90, 0x50, 0x34, 0x8C, 0x9C, 0xB0, 0x59, 0x1B, 0x90, 0x50, 0x31, 0x8C, 0xA0, 0xB4, 0x5C,
+	0x1B, 0x90, 0x50, 0x2E, 0x90, 0xA4, 0xB8, 0x5F, 0x1B, 0x90, 0x50, 0x2A, 0x84, 0x94, 0xA8, 0xB8,
+	0x62, 0x1B, 0x90, 0x50, 0x27, 0x84, 0x98, 0xAC, 0x66, 0x1B, 0x90, 0x50, 0x23, 0x84, 0x90, 0xA0,
+	0xB0, 0x69, 0x1B, 0x90, 0x50, 0x20, 0x84, 0x98, 0xAC, 0x6D, 0x1B, 0x90, 0x50, 0x1D, 0x88, 0x9C,
+	0xAC, 0x6F, 0xB0, 0x1B, 0x90, 0x50, 0x1A, 0x8C, 0xA0, 0xB0, 0x6F, 0xAC, 0x98, 0x88, 0x1C, 0x90,
+	0x50, 0x17, 0x90, 0xA0, 0xB4, 0x6E, 0xB8, 0xA8, 0x98, 0x84, 0x1F, 0x90, 0x50, 0x13, 0x84, 0x94,
+	0xA4, 0xB8, 0x6E, 0xB8, 0xA4, 0x94, 0x84, 0x22, 0x90, 0x50, 0x10, 0x84, 0x94, 0xA8, 0xB8, 0x6E,
+	0xB4, 0xA4, 0x90, 0x26, 0x90, 0x50, 0x0D, 0x88, 0x98, 0xAC, 0x6F, 0xB4, 0xA0, 0x8C, 0x29, 0x90,
+	0x50, 0x09, 0x84, 0x90, 0xA0, 0xB0, 0x6E, 0xB8, 0xA8, 0x98, 0x88, 0x2C, 0x90, 0x50, 0x06, 0x88,
+	0x98, 0xAC, 0x6F, 0xB4, 0xA0, 0x8C, 0x30, 0x90, 0x50, 0x03, 0x88, 0x9C, 0xB0, 0x6F, 0xB0, 0x9C,
+	0x88, 0x33, 0x90, 0x50, 0x00, 0x8C, 0xA0, 0xB4, 0x6F, 0xAC, 0x98, 0x88, 0x36, 0x90, 0x50, 0xB4,
+	0x6E, 0xB8, 0xA8, 0x94, 0x84, 0x39, 0x90, 0x7D, 0xB8, 0xA4, 0x94, 0x84, 0x3C, 0x90, 0x7A, 0xB4,
+	0xA0, 0x90, 0x3F, 0x00, 0x90, 0x77, 0xB0, 0xA0, 0x8C, 0x3F, 0x03, 0x90, 0x73, 0xB8, 0xA8, 0x98,
+	0x88, 0x3F, 0x06, 0x90, 0x70, 0xB0, 0xA0, 0x8C, 0x3F, 0x0A, 0x90, 0x6D, 0xB0, 0x9C, 0x88, 0x3F,
+	0x0D, 0x90, 0x6A, 0xAC, 0x98, 0x84, 0x3F, 0x10, 0x90, 0x66, 0xB8, 0xA8, 0x94, 0x84, 0x3F, 0x13,
+	0x90, 0x63, 0xB8, 0xA4, 0x90, 0x3F, 0x17, 0x90, 0x60, 0xB4, 0xA0, 0x90, 0x3F, 0x1A, 0x90, 0x5D,
+	0xB0, 0x9C, 0x8C, 0x3F, 0x1D, 0x90, 0x59, 0xB4, 0xA4, 0x98, 0x88, 0x3F, 0x20, 0x90, 0x56, 0xB0,
+	0xA0, 0x8C, 0x3F, 0x24, 0x90, 0x53, 0xAC, 0x9C, 0x88, 0x3F, 0x27, 0x90, 0x50, 0xAC, 0x98, 0x84,
+	0x3F, 0x2A, 0x8C, 0xBB, 0xBB, 0xBB, 0xB9, 0xA8, 0x94, 0x84, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x21,
+	// '8'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0E, 0x84, 0x8C,
+	0x90, 0x97, 0x91, 0x8C, 0x84, 0x3F, 0x2F, 0x88, 0x98, 0xA4, 0xB0, 0xB8, 0x4A, 0xB8, 0xB0, 0xA8,
+	0x9C, 0x90, 0x84, 0x3F, 0x84, 0x8C, 0x90, 0x95, 0x98, 0x95, 0x90, 0x8C, 0x84, 0x1B, 0x88, 0x9C,
+	0xB0, 0x55, 0xAC, 0x98, 0x84, 0x37, 0x84, 0x94, 0xA0, 0xAC, 0xB8, 0x4A, 0xB8, 0xAC, 0x9C, 0x8C,
+	0x15, 0x88, 0xA8, 0x5B, 0xA8, 0x90, 0x32, 0x84, 0x94, 0xAC, 0x53, 0xB8, 0xA0, 0x88, 0x10, 0x84,
+	0xA4, 0x5F, 0xAC, 0x8C, 0x2E, 0x88, 0xA4, 0xB8, 0x58, 0xAC, 0x90, 0x0D, 0x9C, 0xB8, 0x62, 0xA8,
+	0x88, 0x2A, 0x84, 0xA4, 0x5D, 0xAC, 0x84, 0x09, 0x84, 0xAC, 0x65, 0xB8, 0x98, 0x28, 0x90, 0xB4,
+	0x5F, 0xB8, 0x8C, 0x07, 0x84, 0xB0, 0x68, 0xA0, 0x26, 0x98, 0x62, 0xB8, 0x90, 0x05, 0x84, 0xB0,
+	0x6A, 0xA4, 0x24, 0xA0, 0x64, 0xB8, 0x8C, 0x04, 0xA8, 0x6C, 0x9C, 0x22, 0x9C, 0x66, 0xB8, 0x84,
+	0x02, 0x98, 0x6E, 0x94, 0x20, 0x94, 0x68, 0xAC, 0x01, 0x88, 0xB8, 0x6E, 0xB8, 0x84, 0x1E, 0x88,
+	0xB8, 0x69, 0x94, 0x00, 0xA4, 0x70, 0xA8, 0x1E, 0xAC, 0x6A, 0xB4, 0x8C, 0x72, 0x90, 0x1C, 0x98,
+	0x6C, 0xB4, 0x51, 0xB0, 0xA4, 0xA0, 0x9A, 0x9C, 0xA0, 0xA8, 0xB0, 0x56, 0xB0, 0x1C, 0xB4, 0x7C,
+	0xA8, 0x90, 0x84, 0x09, 0x84, 0x94, 0xA8, 0x54, 0x8C, 0x1A, 0x94, 0x54, 0xAC, 0x9C, 0x94, 0x8C,
+	0x89, 0x8C, 0x90, 0x98, 0xA0, 0xB0, 0x5B, 0xA4, 0x84, 0x0F, 0x88, 0xA4, 0x52, 0xA0, 0x1A, 0xA8,
+	0x51, 0xB4, 0x98, 0x84, 0x0A, 0x88, 0xA0, 0x57, 0xB4, 0x8C, 0x13, 0x90, 0xB4, 0x50, 0xB4, 0x1A,
+	0xB8, 0x50, 0xA4, 0x84, 0x0E, 0x88, 0xAC, 0x54, 0xB0, 0x84, 0x15, 0x88, 0xB4, 0x50, 0x88, 0x18,
+	0x90, 0x50, 0x9C, 0x12, 0xA8, 0x52, 0xB8, 0x88, 0x17, 0x88, 0xB8, 0x4F, 0x94, 0x18, 0x9C, 0x4F,
+	0xA0, 0x14, 0xAC, 0x51, 0x90, 0x19, 0x90, 0x4F, 0xA0, 0x18, 0xA8, 0x4E, 0xB0, 0x15, 0x88, 0xB8,
+	0x4F, 0xA8, 0x1B, 0xAC, 0x4E, 0xAC, 0x18, 0xB0, 0x4E, 0x94, 0x16, 0xA4, 0x4F, 0x90, 0x1B, 0x90,
+	0x4E, 0xB4, 0x18, 0xB8, 0x4E, 0x84, 0x16, 0x90, 0x4F, 0x1D, 0x4E, 0xB8, 0x18, 0xB8, 0x4D, 0xB4,
+	0x17, 0x84, 0x4E, 0xB4, 0x1D, 0xB4, 0x4E, 0x18, 0x4E, 0xB0, 0x18, 0x4E, 0xAC, 0x1D, 0xAC, 0x4E,
+	0x18, 0x4E, 0xB0, 0x18, 0x4E, 0xB0, 0x1D, 0xB0, 0x4E, 0x18, 0xB8, 0x4D, 0xB4, 0x17, 0x88, 0x4E,
+	0xB4, 0x1D, 0xB4, 0x4D, 0xB8, 0x18, 0xB4, 0x4E, 0x84, 0x16, 0x94, 0x4F, 0x84, 0x1B, 0x84, 0x4E,
+	0xB8, 0x18, 0xB0, 0x4E, 0x98, 0x16, 0xA8, 0x4F, 0x94, 0x1B, 0x94, 0x4E, 0xB0, 0x18, 0xA4, 0x4E,
+	0xB4, 0x84, 0x14, 0x8C, 0x50, 0xB0, 0x1B, 0xB0, 0x4E, 0xA8, 0x18, 0x9C, 0x4F, 0xA4, 0x13, 0x84,
+	0xB0, 0x51, 0x94, 0x19, 0x98, 0x4F, 0xA0, 0x18, 0x8C, 0x50, 0x9C, 0x11, 0x84, 0xAC, 0x52, 0xB8,
+	0x88, 0x17, 0x8C, 0xB8, 0x4F, 0x94, 0x19, 0xB8, 0x50, 0xA8, 0x84, 0x0E, 0x8C, 0xB4, 0x54, 0xB4,
+	0x88, 0x15, 0x8C, 0xB8, 0x50, 0x84, 0x19, 0xA8, 0x51, 0xB8, 0x9C, 0x88, 0x0A, 0x90, 0xA8, 0x57,
+	0xB8, 0x94, 0x13, 0x98, 0xB8, 0x50, 0xB0, 0x1A, 0x90, 0x54, 0xB0, 0xA4, 0x98, 0x94, 0x92, 0x94,
+	0x9C, 0xA8, 0xB8, 0x5B, 0xA8, 0x8C, 0x0F, 0x90, 0xAC, 0x52, 0xA0, 0x1B, 0xB0, 0x7C, 0xAC, 0x98,
+	0x88, 0x09, 0x88, 0x98, 0xB0, 0x54, 0x88, 0x1B, 0x90, 0x6C, 0xB4, 0x51, 0xB8, 0xB0, 0xA8, 0xA7,
+	0xA8, 0xB0, 0xB8, 0x56, 0xA8, 0x1D, 0xA8, 0x6A, 0xB4, 0x88, 0x72, 0x88, 0x1D, 0x84, 0xB8, 0x69,
+	0x94, 0x00, 0xA4, 0x70, 0xA4, 0x1F, 0x90, 0x68, 0xAC, 0x01, 0x88, 0xB8, 0x6E, 0xB4, 0x84, 0x20,
+	0x98, 0x66, 0xB4, 0x84, 0x02, 0x98, 0x6E, 0x90, 0x22, 0x98, 0x64, 0xB8, 0x8C, 0x04, 0xA8, 0x6C,
+	0x98, 0x24, 0x94, 0xB8, 0x61, 0xB8, 0x90, 0x05, 0x84, 0xB0, 0x6A, 0x9C, 0x26, 0x8C, 0xB4, 0x5F,
+	0xB4, 0x8C, 0x07, 0x84, 0xB0, 0x68, 0x9C, 0x29, 0x98, 0xB4, 0x5B, 0xB8, 0xA0, 0x84, 0x09, 0x84,
+	0xA4, 0x65, 0xB4, 0x90, 0x2C, 0x98, 0xB4, 0x58, 0xA4, 0x84, 0x0D, 0x90, 0xB4, 0x62, 0xA0, 0x30,
+	0x90, 0xA4, 0xB8, 0x52, 0xB0, 0x9C, 0x84, 0x10, 0x84, 0xA0, 0xB8, 0x5E, 0xA8, 0x88, 0x34, 0x8C,
+	0x9C, 0xA8, 0xB0, 0xB8, 0x48, 0xB8, 0xB0, 0xA4, 0x98, 0x88, 0x15, 0x88, 0xA0, 0xB8, 0x59, 0xB8,
+	0xA4, 0x88, 0x3B, 0x84, 0x88, 0x8C, 0x93, 0x8C, 0x84, 0x1C, 0x84, 0x98, 0xAC, 0x54, 0xB8, 0xA8,
+	0x94, 0x84, 0x3F, 0x26, 0x84, 0x90, 0xA0, 0xA8, 0xB4, 0x4A, 0xB4, 0xAC, 0xA4, 0x98, 0x8C, 0x3F,
+	0x30, 0x84, 0x88, 0x8C, 0x91, 0x8D, 0x88, 0x84, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26,
+	// '9'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x84, 0x88, 0x8D, 0x93, 0x91,
+	0x8C, 0x88, 0x84, 0x3F, 0x2C, 0x8C, 0x98, 0xA0, 0xAC, 0xB4, 0xB8, 0x4D, 0xB4, 0xB0, 0xA4, 0x9C,
+	0x90, 0x84, 0x3F, 0x21, 0x90, 0xA0, 0xB0, 0x5A, 0xB4, 0xA4, 0x94, 0x84, 0x3F, 0x1A, 0x8C, 0xA4,
+	0xB8, 0x60, 0xB8, 0xA8, 0x90, 0x3F, 0x16, 0x94, 0xB0, 0x66, 0xB4, 0x98, 0x3F, 0x12, 0x90, 0xB4,
+	0x6A, 0xB4, 0x90, 0x15, 0x84, 0x9B, 0x9B, 0x9B, 0x9B, 0x98, 0x90, 0x25, 0x8C, 0xAC, 0x6E, 0xAC,
+	0x88, 0x14, 0xA0, 0x4F, 0xB8, 0x84, 0x23, 0xA0, 0x71, 0xB8, 0x94, 0x14, 0xB0, 0x4F, 0x9C, 0x21,
+	0x84, 0xA8, 0x74, 0x9C, 0x13, 0x8C, 0x4F, 0xB4, 0x20, 0x84, 0xAC, 0x76, 0x98, 0x13, 0xA4, 0x4F,
+	0x90, 0x1F, 0xAC, 0x78, 0x90, 0x12, 0x84, 0xB8, 0x4E, 0xA4, 0x1E, 0xA4, 0x79, 0xB8, 0x84, 0x12,
+	0xA0, 0x4E, 0xB8, 0x1D, 0x94, 0x7B, 0xA8, 0x12, 0x88, 0x4F, 0x90, 0x1B, 0x84, 0xB4, 0x7C, 0x8C,
+	0x12, 0xA8, 0x4E, 0xA0, 0x1B, 0xA0, 0x7D, 0xA8, 0x12, 0x94, 0x4E, 0xB0, 0x1A, 0x88, 0x56, 0xB0,
+	0xA4, 0x9C, 0x98, 0x90, 0x8F, 0x8C, 0x90, 0x94, 0x98, 0xA0, 0xA8, 0xB4, 0x58, 0x88, 0x12, 0xB8,
+	0x4E, 0x1A, 0x9C, 0x52, 0xB8, 0xA4, 0x90, 0x84, 0x0F, 0x84, 0x98, 0xA8, 0x55, 0x98, 0x12, 0xAC,
+	0x4E, 0x88, 0x19, 0xB4, 0x50, 0xB8, 0x98, 0x84, 0x15, 0x88, 0xA4, 0x53, 0xA8, 0x12, 0xA0, 0x4E,
+	0x90, 0x18, 0x88, 0x50, 0xA8, 0x84, 0x19, 0x8C, 0xB0, 0x51, 0xB4, 0x12, 0x98, 0x4E, 0x98, 0x18,
+	0x98, 0x4F, 0xA0, 0x1C, 0x84, 0xAC, 0x51, 0x84, 0x11, 0x90, 0x4E, 0x9C, 0x18, 0xA4, 0x4E, 0xA8,
+	0x1E, 0x84, 0xB4, 0x50, 0x88, 0x11, 0x90, 0x4E, 0x9C, 0x18, 0xAC, 0x4D, 0xB8, 0x84, 0x1F, 0x90,
+	0x50, 0x8C, 0x11, 0x90, 0x4E, 0x9C, 0x18, 0xB4, 0x4D, 0xA0, 0x21, 0xB0, 0x4F, 0x90, 0x11, 0x94,
+	0x4E, 0x9C, 0x18, 0xB8, 0x4D, 0x8C, 0x21, 0x9C, 0x4F, 0x8C, 0x11, 0xA0, 0x4E, 0x98, 0x18, 0x4E,
+	0x84, 0x21, 0x94, 0x4F, 0x88, 0x11, 0xAC, 0x4E, 0x90, 0x18, 0x4E, 0x22, 0x90, 0x4F, 0x84, 0x10,
+	0x84, 0xB8, 0x4E, 0x8C, 0x18, 0xB8, 0x4D, 0x84, 0x21, 0x94, 0x4E, 0xB4, 0x11, 0x94, 0x4F, 0x84,
+	0x18, 0xB8, 0x4D, 0x8C, 0x21, 0x9C, 0x4E, 0xA8, 0x11, 0xB0, 0x4E, 0xB0, 0x19, 0xB0, 0x4D, 0x9C,
+	0x21, 0xAC, 0x4E, 0x98, 0x10, 0x98, 0x4F, 0xA4, 0x19, 0xA8, 0x4D, 0xB4, 0x20, 0x88, 0x4F, 0x84,
+	0x0F, 0x88, 0xB8, 0x4F, 0x94, 0x19, 0xA0, 0x4E, 0xA0, 0x1E, 0x84, 0xB0, 0x4E, 0xA4, 0x0F, 0x88,
+	0xB4, 0x4F, 0xB8, 0x84, 0x19, 0x90, 0x4F, 0xA0, 0x1C, 0x84, 0xAC, 0x4E, 0xB8, 0x84, 0x0E, 0x8C,
+	0xB8, 0x50, 0xA8, 0x1A, 0x84, 0x50, 0xA8, 0x84, 0x19, 0x88, 0xB0, 0x4F, 0x98, 0x0E, 0x98, 0x52,
+	0x8C, 0x1B, 0xAC, 0x50, 0xB8, 0x9C, 0x84, 0x15, 0x88, 0xA4, 0x50, 0xA8, 0x0D, 0x8C, 0xAC, 0x52,
+	0xB0, 0x1C, 0x94, 0x52, 0xB8, 0xA8, 0x94, 0x84, 0x0F, 0x88, 0x98, 0xAC, 0x51, 0xB0, 0x84, 0x0B,
+	0x90, 0xA8, 0x54, 0x90, 0x1D, 0xB8, 0x55, 0xB4, 0xA8, 0xA0, 0x9C, 0x95, 0x93, 0x94, 0x98, 0x9C,
+	0xA4, 0xAC, 0xB8, 0x53, 0xAC, 0x84, 0x09, 0x8C, 0x9C, 0xB4, 0x55, 0xAC, 0x1E, 0x9C, 0x78, 0xA0,
+	0x06, 0x84, 0x8C, 0x98, 0xA4, 0xB4, 0x57, 0xB8, 0x88, 0x1E, 0x84, 0xB4, 0x75, 0xB8, 0x9C, 0x91,
+	0x94, 0x98, 0xA0, 0xA4, 0xAC, 0xB4, 0x5C, 0x98, 0x20, 0x90, 0x7F, 0x5B, 0xA0, 0x22, 0x9C, 0x7F,
+	0x59, 0xA0, 0x24, 0xA4, 0x7F, 0x57, 0xA4, 0x26, 0xA8, 0x7F, 0x55, 0x9C, 0x28, 0xA4, 0x7F, 0x52,
+	0xB8, 0x94, 0x2A, 0x98, 0x7F, 0x50, 0xAC, 0x88, 0x2C, 0x8C, 0xB0, 0x7F, 0x4C, 0xB8, 0x98, 0x30,
+	0x98, 0xB8, 0x7F, 0x49, 0xA0, 0x84, 0x32, 0x84, 0x98, 0xB0, 0x7F, 0x44, 0xB4, 0x9C, 0x84, 0x37,
+	0x8C, 0xA0, 0xB8, 0x7E, 0xB8, 0xA4, 0x8C, 0x3D, 0x90, 0xA4, 0xB4, 0x78, 0xB8, 0xA4, 0x94, 0x3F,
+	0x03, 0x88, 0x98, 0xA4, 0xB4, 0x70, 0xB8, 0xAC, 0x9C, 0x8C, 0x3F, 0x0A, 0x84, 0x90, 0x98, 0xA4,
+	0xAC, 0xB4, 0x65, 0xB4, 0xAC, 0xA0, 0x94, 0x88, 0x3F, 0x15, 0x88, 0x90, 0x98, 0x9C, 0xA0, 0xA8,
+	0xAC, 0xB0, 0xB4, 0xB9, 0x4E, 0xB9, 0xB4, 0xB0, 0xA8, 0xA4, 0xA0, 0x98, 0x90, 0x88, 0x84, 0x3F,
+	0x27, 0x85, 0x8B, 0x8B, 0x85, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3A,
+	// '+'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3C, 0x90, 0xA7, 0xA7, 0xA7, 0xA6, 0x88, 0x3F, 0x2E, 0xA0,
+	0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E,
+	0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90,
+	0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F,
+	0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E,
+	0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0,
+	0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E,
+	0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x12, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0xA4,
+	0x4E, 0x94, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36,
+	0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F,
+	0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x7F, 0x48, 0x36, 0x87, 0x87,
+	0x87, 0x87, 0x87, 0x87, 0x87, 0xA0, 0x4E, 0x90, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x3F,
+	0x12, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E,
+	0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0,
+	0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E,
+	0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90,
+	0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F,
+	0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E,
+	0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0xA0, 0x4E, 0x90, 0x3F, 0x2E, 0x88, 0x93, 0x93, 0x93, 0x92, 0x84,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x31,
+	// '-'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x94,
+	0x9B, 0x9B, 0x9B, 0x9B, 0x99, 0x8C, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0,
+	0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F,
+	0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B,
+	0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC,
+	0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51,
+	0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0,
+	0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F,
+	0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B,
+	0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC,
+	0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0xAC, 0x51,
+	0xA0, 0x3F, 0x2B, 0xAC, 0x51, 0xA0, 0x3F, 0x2B, 0x90, 0x97, 0x97, 0x97, 0x97, 0x95, 0x88, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x2C,
+	// '.'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16,
+	0x8C, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F,
+	0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F,
+	0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F,
+	0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F,
+	0x26, 0x90, 0x57, 0x3F, 0x26, 0x90, 0x57, 0x3F, 0x26, 0x88, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+	// ','
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3C, 0x88, 0x94, 0x9C, 0x3F, 0x37, 0x88, 0x94, 0xA0,
+	0xB0, 0xB8, 0x42, 0x3F, 0x32, 0x88, 0x94, 0xA0, 0xAC, 0xB8, 0x47, 0x3F, 0x2D, 0x84, 0x90, 0x9C,
+	0xAC, 0xB8, 0x4C, 0x3F, 0x17, 0x8B, 0x8B, 0x8B, 0x8B, 0x89, 0x90, 0x9C, 0xA8, 0xB4, 0x51, 0x3F,
+	0x16, 0x90, 0x67, 0x3F, 0x16, 0x90, 0x67, 0x3F, 0x16, 0x90, 0x67, 0x3F, 0x16, 0x90, 0x67, 0x3F,
+	0x16, 0x90, 0x67, 0x3F, 0x16, 0x90, 0x67, 0x3F, 0x16, 0x90, 0x67, 0x3F, 0x16, 0x90, 0x65, 0xB4,
+	0x9C, 0x3F, 0x16, 0x90, 0x63, 0xA8, 0x90, 0x3F, 0x18, 0x90, 0x60, 0xB4, 0x9C, 0x84, 0x3F, 0x1A,
+	0x90, 0x5E, 0xAC, 0x90, 0x3F, 0x1D, 0x90, 0x5B, 0xB0, 0x9C, 0x88, 0x3F, 0x1F, 0x90, 0x58, 0xB8,
+	0xA0, 0x88, 0x3F, 0x22, 0x90, 0x56, 0xB0, 0x98, 0x84, 0x3F, 0x24, 0x90, 0x53, 0xB8, 0xA4, 0x8C,
+	0x3F, 0x27, 0x90, 0x51, 0xB0, 0x98, 0x84, 0x3F, 0x2A, 0x8B, 0x8B, 0x8B, 0x8B, 0x89, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x15,
+	// ':'
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x98,
+	0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAE, 0xA0, 0x14, 0x8C, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0x38,
+	0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56,
+	0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14,
+	0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57,
+	0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0,
+	0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC,
+	0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90,
+	0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38, 0xA0, 0x56, 0xAC, 0x14, 0x90, 0x57, 0x38,
+	0x90, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA2, 0x98, 0x14, 0x88, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+};
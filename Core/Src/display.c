@@ -13,6 +13,8 @@
 #include "lcd.h"
 #include "lt7680.h"
 #include "display.h"
+#include "mainfont.h"
+#include "aadigits.h"
 #include <string.h>  // For strchr, strncpy
 #include <stdio.h>   // For debugging (optional)
 
@@ -28,34 +30,248 @@ uint32_t AuxColourForeLS = 0xA0A0A0;		// Grey
 
 extern volatile uint32_t dbg_loop_per_sec;
 
+volatile uint32_t annuncSpiBytesPerSec = 0;	// Live Watch: LT7680 SPI bytes spent on annunciators over the last second
+volatile uint32_t mainSpiBytesPerSec = 0;		// Live Watch: same for the MAIN reading
+volatile LT7680_RenderProfile displayProfMain;		// Live Watch: SPI bytes, CS transactions and bus time of the last MAIN redraw
+volatile LT7680_RenderProfile displayProfAnnunc;	// Live Watch: same for the last annunciator update
+
+#if MAIN_GLYPH_ATLAS
+static uint8_t mainAtlasValid = 0;			// Atlas rendered, in the colours below
+static uint32_t mainAtlasFore, mainAtlasBack;
+#endif
+
+#if MAIN_AA_DIGITS
+#if LT7680_LL_FRAME16
+#error "MAIN_AA_DIGITS streams 8-bit frames, not with LT7680_LL_FRAME16"
+#endif
+static uint16_t aaPalette[AA_DIGIT_LEVELS];		// RGB565 per coverage level, in the colours below
+static uint8_t aaPaletteValid = 0;
+static uint32_t aaPaletteFore, aaPaletteBack;
+static uint16_t aaBuf[2][MAIN_AA_CHUNK_PIXELS];	// One half on the DMA while the other is decoded
+static const uint8_t* aaRle;					// Next code of the glyph being streamed
+static uint16_t aaRunPixel;						// and the run it left unfinished
+static uint8_t aaRunLeft;
+#endif
+
 
 //************************************************************************************************************************************************************
 
-void DisplayMain(void)
+// CCR0 font source for a MAIN character: 10b user-defined (CGRAM) when mainfont.c has it, else 00b internal CGROM
+static uint8_t MainFontSource(char c)
+{
+#if MAIN_USER_FONT
+	if (c != '\0' && strchr(mainFontCodes, c) != NULL) return 0b10;
+#endif
+	(void)c;
+	return 0b00;
+}
+
+
+// Boot: put the MAIN user-defined font into the LT7680 CGRAM, before BuildMainGlyphAtlas()
+// Upload time and SPI cost in lt7680UserFontUploadUs / lt7680ProfUserFont
+void LoadMainFont(void)
+{
+#if MAIN_USER_FONT
+	LT7680_UserFontUpload(mainFontCodes, &mainFont16x32[0][0], MAIN_FONT_GLYPH_BYTES);
+#endif
+}
+
+
+// Boot, after LT7680_PageInit(): clear the annunciator image and show the strip from it through PIP1
+// From here annunciator changes only touch that image, never the MAIN pages, and need no page flip
+void InitAnnunciatorLayer(void)
+{
+#if ANNUNC_PIP
+	SetCanvas(LT7680_PIP_ADDR, LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+	FillRect(0, 0, LCD_XSIZE_TFT, LCD_YSIZE_TFT, BackgroundColour);
+	SetCanvas(LT7680_PageBackAddr(), LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+
+	LT7680_PipEnable(LT7680_PIP_ADDR, ANNUNC_PIP_X, 0, ANNUNC_PIP_WIDTH, LCD_YSIZE_TFT);
+#endif
+}
+
+
+// Atlas cell of a MAIN character, -1 = not in the atlas (or atlas disabled), draw it with the text engine
+static int MainGlyphSlot(char c)
+{
+#if MAIN_GLYPH_ATLAS
+	uint8_t u = (uint8_t)c;
+
+	if (u >= 0x20 && u <= 0x7E) return u - 0x20;
+	if (u == 0xB5) return MAIN_ATLAS_GLYPHS - 1;
+#endif
+	(void)c;
+	return -1;
+}
+
+
+// Glyph of a MAIN character in aadigits.c, -1 = not there (or MAIN_AA_DIGITS off)
+static int MainAaSlot(char c)
+{
+#if MAIN_AA_DIGITS
+	const char* p = (c != '\0') ? strchr(aaDigitCodes, c) : NULL;
+
+	if (p != NULL) return (int)(p - aaDigitCodes);
+#endif
+	(void)c;
+	return -1;
+}
+
+
+#if MAIN_AA_DIGITS
+// Foreground over background at each coverage level, RGB888 blended then packed to RGB565
+static void MainAaPalette(void)
+{
+	for (int a = 0; a < AA_DIGIT_LEVELS; a++) {
+		uint32_t rgb = 0;
+
+		for (int shift = 0; shift < 24; shift += 8) {
+			uint32_t f = (MainColourFore >> shift) & 0xFF;
+			uint32_t b = (BackgroundColour >> shift) & 0xFF;
+			rgb |= ((f * a + b * (AA_DIGIT_LEVELS - 1 - a)) / (AA_DIGIT_LEVELS - 1)) << shift;
+		}
+		aaPalette[a] = (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+	}
+
+	aaPaletteFore = MainColourFore;
+	aaPaletteBack = BackgroundColour;
+	aaPaletteValid = 1;
+}
+
+
+// Next 'n' pixels of the glyph at aaRle, codes as described in aadigits.c
+static void MainAaDecode(uint16_t* out, uint16_t n)
 {
+	while (n) {
+		if (aaRunLeft == 0) {
+			uint8_t code = *aaRle++;
+
+			if (code & 0x80) {
+				aaRunPixel = aaPalette[(code >> 2) & 0x0F];
+				aaRunLeft = (code & 0x03) + 1;
+			}
+			else {
+				aaRunPixel = aaPalette[(code & 0x40) ? AA_DIGIT_LEVELS - 1 : 0];
+				aaRunLeft = (code & 0x3F) + 1;
+			}
+		}
+
+		uint8_t k = (aaRunLeft < n) ? aaRunLeft : (uint8_t)n;
+		aaRunLeft -= k;
+		n -= k;
+		while (k--) *out++ = aaRunPixel;
+	}
+}
+#endif
+
+
+// Stream the anti-aliased glyph 'slot' into MAIN cell 'cell' as one memory write (one CS transaction)
+// The next chunk is decoded while the DMA sends the previous one, the CPU only waits if decoding is the faster
+// Time per glyph and time spent waiting in lt7680StreamBlockUs / lt7680StreamWaitUs
+static void DrawMainAaDigit(int slot, int cell)
+{
+#if MAIN_AA_DIGITS
+	uint32_t left = (uint32_t)MAIN_CHAR_HEIGHT * MAIN_CHAR_PITCH;
+	uint8_t b = 0;
+
+	if (!aaPaletteValid || aaPaletteFore != MainColourFore || aaPaletteBack != BackgroundColour) {
+		MainAaPalette();
+	}
+
+	aaRle = &aaDigitRle[aaDigitOffset[slot]];
+	aaRunLeft = 0;
+
+	// Cell is MAIN_CHAR_HEIGHT along X (glyph rows, rotated) by MAIN_CHAR_PITCH along Y, aadigits.c is stored in that order
+	LT7680_StreamBegin(Xpos_MAIN, Ypos_MAIN + cell * MAIN_CHAR_PITCH, MAIN_CHAR_HEIGHT, MAIN_CHAR_PITCH);
+	while (left) {
+		uint16_t n = (left > MAIN_AA_CHUNK_PIXELS) ? MAIN_AA_CHUNK_PIXELS : (uint16_t)left;
+
+		MainAaDecode(aaBuf[b], n);
+		LT7680_StreamChunk((const uint8_t*)aaBuf[b], n * 2);
+		b ^= 1;
+		left -= n;
+	}
+	LT7680_StreamEnd();
+#else
+	(void)slot;
+	(void)cell;
+#endif
+}
+
+
+// Render every MAIN character once into the off-screen atlas at MAIN_ATLAS_ADDR, same font as DisplayMain()
+// One cell per character, MAIN_CHAR_HEIGHT x MAIN_CHAR_PITCH, so a cell copy also covers the character spacing
+// Cells carry the colours, DisplayMain() calls this again when MainColourFore/BackgroundColour change
+void BuildMainGlyphAtlas(void)
+{
+#if MAIN_GLYPH_ATLAS
+	char glyph[2] = { ' ', '\0' };
+
+	SetCanvas(MAIN_ATLAS_ADDR, MAIN_ATLAS_WIDTH, MAIN_ATLAS_HEIGHT);
+	FillRect(0, 0, MAIN_ATLAS_WIDTH, MAIN_ATLAS_HEIGHT, BackgroundColour);
+
 	SetTextColors(MainColourFore, BackgroundColour); // Foreground, Background
-	ConfigureFontAndPosition(
-		0b00,    // Internal CGROM
-		0b10,    // Font size
-		0b00,    // ISO 8859-1
-		0,       // Full alignment enabled
-		0,       // Chroma keying disabled
-		1,       // Rotate 90 degrees counterclockwise
-		0b11,    // Width multiplier
-		0b11,    // Height multiplier
-		1,       // Line spacing
-		4,       // Character spacing
-		Xpos_MAIN,     // Cursor X
-		Ypos_MAIN      // Cursor Y
-	);
+
+	for (int slot = 0; slot < MAIN_ATLAS_GLYPHS; slot++) {
+		glyph[0] = (slot < MAIN_ATLAS_GLYPHS - 1) ? (char)(0x20 + slot) : (char)0xB5;
+		ConfigureFontAndPosition(
+			MainFontSource(glyph[0]),    // User-defined or internal CGROM
+			0b10,    // Font size
+			0b00,    // ISO 8859-1
+			0,       // Full alignment enabled
+			0,       // Chroma keying disabled
+			1,       // Rotate 90 degrees counterclockwise
+			0b11,    // Width multiplier
+			0b11,    // Height multiplier
+			1,       // Line spacing
+			4,       // Character spacing
+			0,       // Cursor X
+			slot * MAIN_CHAR_PITCH       // Cursor Y
+		);
+		DrawText(glyph);
+	}
+
+	SetCanvas(LT7680_PageBackAddr(), LCD_XSIZE_TFT, LCD_YSIZE_TFT);	// Back to the page being drawn
+
+	mainAtlasFore = MainColourFore;
+	mainAtlasBack = BackgroundColour;
+	mainAtlasValid = 1;
+#endif
+}
+
+
+//************************************************************************************************************************************************************
+
+void DisplayMain(void)
+{
+	static uint32_t renderedSeq = 0xFFFFFFFF;	// DMM_Frame.seq on screen, first pass always draws
+	static char shown[MAIN_CHARS + 1];			// Last line sent to the LT7680, '\0' = cell unknown
+	static uint32_t shownFore, shownBack;
+	static uint32_t spiBytes = 0;				// Bytes sent in the current one second window
+	static uint32_t windowStart = 0;
+
+	uint32_t now = HAL_GetTick();
+	if ((now - windowStart) >= 1000) {
+		mainSpiBytesPerSec = spiBytes;
+		spiBytes = 0;
+		windowStart = now;
+	}
+
+	if (DMM_FrameGeneration() == renderedSeq) return;	// Steady reading, nothing to send to the LT7680
+
+	LT7680_PROFILE_BEGIN();
 
 	// Always draw exactly 14 characters (13 source + 1 added)
 	char text1[15];   // 14 chars + terminator
 	int i;
+	DMM_Frame frame;
+
+	DMM_FrameSnapshot(&frame);	// Consistent copy, the decoder may publish a new frame at any time
+	renderedSeq = frame.seq;
 
 	// Copy the 13 source characters (displayWithPunct is always 13 chars)
 	for (i = 0; i < 13; i++) {
-		char c = displayWithPunct[i];
+		char c = frame.text[i];
 		text1[i] = (c == '\0') ? ' ' : c;
 	}
 
@@ -71,7 +287,92 @@ void DisplayMain(void)
 	//memcpy(text1, "12345678901234", 14);
 	//text1[14] = '\0';
 
-	DrawText(text1);
+	// Colour change makes every cell dirty
+	if (shownFore != MainColourFore || shownBack != BackgroundColour) {
+		memset(shown, 0, sizeof(shown));
+		shownFore = MainColourFore;
+		shownBack = BackgroundColour;
+	}
+
+#if MAIN_GLYPH_ATLAS
+	if (!mainAtlasValid || mainAtlasFore != MainColourFore || mainAtlasBack != BackgroundColour) {
+		BuildMainGlyphAtlas();
+	}
+#endif
+
+	// Only redraw cells that differ from what is on screen
+	// Anti-aliased digits are one streamed memory write per cell, atlas characters one BTE copy per cell,
+	// anything else goes through the text engine with adjacent dirty cells as one run
+	uint8_t configured = 0;
+	uint8_t configuredSource = 0;
+
+	for (i = 0; i < MAIN_CHARS; ) {
+		if (text1[i] == shown[i]) {
+			i++;
+			continue;
+		}
+
+		int slot = MainAaSlot(text1[i]);
+		if (slot >= 0) {
+			DrawMainAaDigit(slot, i);
+			LT7680_PageDirty(Xpos_MAIN, Ypos_MAIN + i * MAIN_CHAR_PITCH, MAIN_CHAR_HEIGHT, MAIN_CHAR_PITCH);
+			shown[i] = text1[i];
+			i++;
+			continue;
+		}
+
+		slot = MainGlyphSlot(text1[i]);
+		if (slot >= 0) {
+			CopyRect(MAIN_ATLAS_ADDR, MAIN_ATLAS_WIDTH, 0, slot * MAIN_CHAR_PITCH,
+				Xpos_MAIN, Ypos_MAIN + i * MAIN_CHAR_PITCH, MAIN_CHAR_HEIGHT, MAIN_CHAR_PITCH);
+			LT7680_PageDirty(Xpos_MAIN, Ypos_MAIN + i * MAIN_CHAR_PITCH, MAIN_CHAR_HEIGHT, MAIN_CHAR_PITCH);
+			shown[i] = text1[i];
+			i++;
+			continue;
+		}
+
+		int start = i;
+		char run[MAIN_CHARS + 1];
+		int n = 0;
+
+		while (i < MAIN_CHARS && text1[i] != shown[i] && MainGlyphSlot(text1[i]) < 0 && MainAaSlot(text1[i]) < 0 &&
+			MainFontSource(text1[i]) == MainFontSource(text1[start])) {
+			run[n++] = text1[i];
+			shown[i] = text1[i];
+			i++;
+		}
+		run[n] = '\0';
+
+		if (!configured || MainFontSource(run[0]) != configuredSource) {
+			// Font settings are shared with the annunciators, so set them before the first run, a run never mixes font sources
+			configuredSource = MainFontSource(run[0]);
+			SetTextColors(MainColourFore, BackgroundColour); // Foreground, Background
+			ConfigureFontAndPosition(
+				configuredSource,    // User-defined or internal CGROM
+				0b10,    // Font size
+				0b00,    // ISO 8859-1
+				0,       // Full alignment enabled
+				0,       // Chroma keying disabled
+				1,       // Rotate 90 degrees counterclockwise
+				0b11,    // Width multiplier
+				0b11,    // Height multiplier
+				1,       // Line spacing
+				4,       // Character spacing
+				Xpos_MAIN,     // Cursor X
+				Ypos_MAIN + start * MAIN_CHAR_PITCH      // Cursor Y
+			);
+			configured = 1;
+		}
+		else {
+			SetTextCursor(Xpos_MAIN, Ypos_MAIN + start * MAIN_CHAR_PITCH);
+		}
+
+		DrawText(run);
+		LT7680_PageDirty(Xpos_MAIN, Ypos_MAIN + start * MAIN_CHAR_PITCH, MAIN_CHAR_HEIGHT, n * MAIN_CHAR_PITCH);
+	}
+
+	spiBytes += lt7680SpiBytes - lt7680Bytes0;
+	LT7680_PROFILE_END(displayProfMain);
 }
 
 
@@ -176,9 +477,45 @@ void DisplayAnnunciators() {
 	};
 
 
+	static uint32_t renderedSeq = 0xFFFFFFFF;	// DMM_Frame.seq on screen, first pass always draws
+	static uint16_t shownMask = 0;				// Bit i = AnnuncNames[i] lit on screen
+	static uint8_t shownValid = 0;				// 0 until the first full pass, screen state unknown
+	static uint32_t spiBytes = 0;				// Bytes sent in the current one second window
+	static uint32_t windowStart = 0;
+	DMM_Frame frame;
+
+	uint32_t now = HAL_GetTick();
+	if ((now - windowStart) >= 1000) {
+		annuncSpiBytesPerSec = spiBytes;
+		spiBytes = 0;
+		windowStart = now;
+	}
+
+	if (DMM_FrameGeneration() == renderedSeq) return;	// Nothing changed
+
+	DMM_FrameSnapshot(&frame);	// All 12 from the same frame
+	renderedSeq = frame.seq;
+
+	uint16_t mask = 0;
 	for (int i = 0; i < 12; i++) {
-		if (Annunc[12 - i] == 1) {  // Turn the annunciator ON
-			SetTextColors(AnnunColourFore, BackgroundColour); // Foreground: Green, Background: Black
+		if (frame.annunc[12 - i] == 1) mask |= (uint16_t)(1u << i);
+	}
+
+	// Only touch the labels that flipped, a new reading with the same annunciators costs no SPI at all
+	uint16_t changed = shownValid ? (uint16_t)(mask ^ shownMask) : 0x0FFF;
+	if (changed == 0) return;
+
+	LT7680_PROFILE_BEGIN();
+
+#if ANNUNC_PIP
+	SetCanvas(LT7680_PIP_ADDR, LCD_XSIZE_TFT, LCD_YSIZE_TFT);	// Annunciator layer only
+#endif
+
+	for (int i = 0; i < 12; i++) {
+		if (!(changed & (1u << i))) continue;
+
+		if (mask & (1u << i)) {  // Turn the annunciator ON
+			SetTextColors(AnnunColourFore, BackgroundColour); // Foreground: Green, Background: Black (a fill may have changed D2-D4)
 			ConfigureFontAndPosition(
 				0b00,    // Internal CGROM
 				0b00,    // 16-dot font size
@@ -201,26 +538,29 @@ void DisplayAnnunciators() {
 
 			DrawText(AnnuncNames[i]); // Print the corresponding name
 		}
-		else {  // Turn the annunciator OFF
-			SetTextColors(BackgroundColour, BackgroundColour); // Foreground: Black, Background: Black
-			ConfigureFontAndPosition(
-				0b00,    // Internal CGROM
-				0b00,    // 16-dot font size
-				0b00,    // ISO 8859-1
-				0,       // Full alignment enabled
-				0,       // Chroma keying disabled
-				1,       // Rotate 90 degrees counterclockwise
-				0b01,    // Width X0
-				0b01,    // Height X0
-				5,       // Line spacing
-				0,       // Character spacing
-				Xpos_ANNUNC,  // Cursor X (fixed)
-				AnnuncYCoords[i] // Cursor Y (from array)
+		else {  // Turn the annunciator OFF - hardware fill over the label, no text drawing
+			DrawFilledRectangle(
+				Xpos_ANNUNC,
+				AnnuncYCoords[i],
+				Xpos_ANNUNC + ANNUNC_CHAR_HEIGHT - 1,
+				AnnuncYCoords[i] + strlen(AnnuncNames[i]) * ANNUNC_CHAR_PITCH - 1,
+				BackgroundColour
 			);
-			DrawText(AnnuncNames[i]); // Clear the text by drawing in black
 		}
+
+#if !ANNUNC_PIP
+		LT7680_PageDirty(Xpos_ANNUNC, AnnuncYCoords[i], ANNUNC_CHAR_HEIGHT, strlen(AnnuncNames[i]) * ANNUNC_CHAR_PITCH);
+#endif
 	}
 
+#if ANNUNC_PIP
+	SetCanvas(LT7680_PageBackAddr(), LCD_XSIZE_TFT, LCD_YSIZE_TFT);	// Back to the MAIN page being drawn
+#endif
+
+	shownMask = mask;
+	shownValid = 1;
+	spiBytes += lt7680SpiBytes - lt7680Bytes0;
+	LT7680_PROFILE_END(displayProfAnnunc);
 }
 
 
@@ -243,7 +583,7 @@ void DisplaySplash() {
 		Ypos_SPLASH      // Cursor Y
 	);
 
-	DrawText("Protocol by xi, TFT Upgrade by Ian Johnston") & '\0';
+	DrawText("Protocol by xi, TFT Upgrade by Ian Johnston");
 
 	HAL_Delay(10);
 
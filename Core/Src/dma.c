@@ -8,6 +8,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "dma.h"
+#include "lt7680.h"
 
 /*----------------------------------------------------------------------------*/
 /* Configure DMA                                                              */
@@ -24,11 +25,22 @@ void MX_DMA_Init(void)
 
   /* DMA interrupt init */
   /* DMA1_Channel3_IRQn interrupt configuration */
+#if LT7680_ASYNC_QUEUE
+  HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, LT7680_QUEUE_IRQ_PRIO, 0);   // LT7680 command queue, one STSR read per status wait pass
+#else
   HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 3, 0);
+#endif
   HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
   /* DMA1_Channel4_IRQn interrupt configuration */
-  //HAL_NVIC_SetPriority(DMA1_Channel4_IRQn, 0, 0);
-  //HAL_NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+  HAL_NVIC_SetPriority(DMA1_Channel4_IRQn, 3, 0);   // SPI2 capture ring drain, just below SYNC/TIM3 (ladder in main.h)
+  HAL_NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+#endif
+  /* DMA1_Channel2_IRQn interrupt configuration */
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+  HAL_NVIC_SetPriority(DMA1_Channel2_IRQn, 3, 0);   // GPIOB sample ring decode, just below SYNC/TIM3 (ladder in main.h)
+  HAL_NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+#endif
 
 }
 
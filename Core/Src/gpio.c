@@ -54,7 +54,11 @@ void MX_GPIO_Init(void) {
     // These are 5Vdc tolerant pins on the Blue Pill so can interface directly with the 3457A 5V logic levels
     /* Configure GPIO pin : DMM_SYNC_Pin */
     GPIO_InitStruct.Pin = DMM_SYNC_Pin;
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;   // rising = ISA phase (realign SPI2), falling = INA phase
+#else
     GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;   // rising edge = start of command
+#endif
     GPIO_InitStruct.Pull = GPIO_NOPULL;
     HAL_GPIO_Init(DMM_SYNC_GPIO_Port, &GPIO_InitStruct);
 
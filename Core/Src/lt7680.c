@@ -30,6 +30,7 @@
 
 #include "lt7680.h"
 #include "main.h"
+#include "timer.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -42,8 +43,67 @@ volatile uint8_t system_ok = 0;
 volatile uint8_t LT7680_SPI_Read_ok = 0;
 volatile uint8_t System_Check = 0;
 volatile uint8_t SystemCheckTempValue = 0;
+volatile uint32_t lt7680SpiBytes = 0;        // Live Watch: bytes clocked on SPI1 to/from the LT7680 since boot
+volatile uint32_t lt7680SpiXfers = 0;        // Live Watch: CS transactions since boot
+volatile LT7680_RenderProfile lt7680ProfClearScreen;    // Live Watch: SPI cost of the last ClearScreen()
+volatile uint32_t lt7680RegWritesIssued = 0;     // Live Watch: WriteDataToRegister() calls sent to the LT7680
+volatile uint32_t lt7680RegWritesSuppressed = 0; // Live Watch: WriteDataToRegister() calls skipped, value already in the register
+volatile uint32_t lt7680TextChunks = 0;          // Live Watch: DrawText() chunks, one FIFO status check each
+volatile uint32_t lt7680WaitTimeouts = 0;        // Live Watch: status waits that gave up after LT7680_WAIT_TIMEOUT_MS
+
+// Register shadow - last value written to each LT7680 register, so unchanged configuration writes can be skipped
+static uint8_t lt7680Shadow[256];
+static uint8_t lt7680ShadowValid[256 / 8];      // bit per register, 0 = value unknown (after reset)
+static uint16_t lt7680SelectedReg = 0x100;      // register last addressed by WriteRegister(), 0x100 = none
+
+// Registers that must never be suppressed: triggers, data ports, status/flags and anything the LT7680 changes by itself
+static const uint8_t lt7680RegVolatile[256] = {
+    [0x00]        = 1,  // SRR - software reset
+    [0x01]        = 1,  // CCR - bit 7 reconfigures the PLL
+    [0x04]        = 1,  // MRWDP - memory/text data port
+    [0x0C]        = 1,  // INTF - write 1 to clear
+    [0x5F ... 0x62] = 1,  // Graphic read/write position, auto-increments
+    [0x63 ... 0x66] = 1,  // Text cursor, advances with every character
+    [0x67]        = 1,  // DCR0 - draw line/triangle start
+    [0x76]        = 1,  // DCR1 - draw circle/ellipse/square start
+    [0x88]        = 1,  // PCFGR - PWM start/stop
+    [0x90]        = 1,  // BTE_CTRL0 - BTE start
+    [0xB5 ... 0xBF] = 1,  // Serial flash/SPI master, data and status (0xB0-0xB4 are BTE width/height, cached)
+    [0xDF]        = 1,  // PMU - power mode / sleep
+    [0xE4]        = 1,  // SDRCR - SDRAM initialise
+};
+
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+// Live Watch: DWT timing of the hot register sequences, switch LT7680_SPI_TRANSPORT to compare
+volatile uint32_t lt7680FontCallUs = 0, lt7680FontCallUsMax = 0;        // ConfigureFontAndPosition()
+volatile uint32_t lt7680ColorsCallUs = 0, lt7680ColorsCallUsMax = 0;    // SetTextColors()
+volatile uint32_t lt7680LineCallUs = 0, lt7680LineCallUsMax = 0;        // DrawLine()
+#define LT7680_CALL_US(cycles)   (((cycles) + (SystemCoreClock / 1000000u) - 1u) / (SystemCoreClock / 1000000u))
+#endif
+
+static void LT7680_ShadowInvalidate(void) {
+    memset(lt7680ShadowValid, 0, sizeof(lt7680ShadowValid));
+}
+
+static void LT7680_ShadowStore(uint16_t reg, uint8_t data) {
+    if (reg == REG_CONTROL) {
+        LT7680_ShadowInvalidate();                              // Software reset
+    }
+    else if (reg < 0x100) {
+        lt7680Shadow[reg] = data;
+        lt7680ShadowValid[reg >> 3] |= (uint8_t)(1u << (reg & 7));
+    }
+}
+
+// 1 = register already holds 'value' and is not in lt7680RegVolatile[], the write can be skipped
+static uint8_t LT7680_ShadowHit(uint8_t reg, uint8_t value) {
+    return !lt7680RegVolatile[reg] &&
+           (lt7680ShadowValid[reg >> 3] & (1u << (reg & 7))) &&
+           lt7680Shadow[reg] == value;
+}
 
 void HardwareReset(void) {
+    LT7680_ShadowInvalidate();                                  // LT7680 registers back to defaults
     HAL_GPIO_WritePin(RESET_PORT, RESET_PIN, GPIO_PIN_RESET); // Pull reset low
     HAL_Delay(100); // Delay 100 ms
     HAL_GPIO_WritePin(RESET_PORT, RESET_PIN, GPIO_PIN_SET);   // Release reset
@@ -52,35 +112,30 @@ void HardwareReset(void) {
 
 
 //**************************************************************************************************
-// Core commands
-
-// Write Register Address
-void WriteRegister(uint8_t reg) {
-    uint8_t controlByte = 0x00; // A0 = 0, RW = 0
+// SPI1 byte transport
+//
+// LT7680_DRV_HAL - HAL_SPI_Transmit()/Receive(), locking, state checks and timeout bookkeeping per call
+// LT7680_DRV_LL  - SPI1->DR/SR direct: TXE polled per byte, BSY once before CS goes high, RX dropped
+// LT7680_LL_FRAME16 runs the LL driver with 16-bit frames, so control + payload is a single DR write.
+// HAL_SPI_Transmit_DMA() (command queue) only runs while these are idle, both leave SPI1 in a state it accepts.
+
+#define LT7680_CS_LOW()     (SPI_CS_PORT->BRR = SPI_CS_PIN)
+#define LT7680_CS_HIGH()    (SPI_CS_PORT->BSRR = SPI_CS_PIN)
+#define LT7680_LL_SPIN_MAX  20000       // SR polls before a LL read gives up, ~1ms at 72MHz (no uwTick, it may run in an IRQ)
+
+static inline void LT7680_HalWrite(const uint8_t* bytes, uint8_t len) {
     HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
-    HAL_SPI_Transmit(&hspi1, &controlByte, 1, HAL_MAX_DELAY);                 // Send control byte
-    HAL_SPI_Transmit(&hspi1, &reg, 1, HAL_MAX_DELAY);                         // Send register address
+    HAL_SPI_Transmit(&hspi1, (uint8_t*)bytes, len, HAL_MAX_DELAY);
     HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
 }
 
-// Write Data
-void WriteData(uint8_t data) {
-    uint8_t controlByte = 0x80; // A0 = 1, RW = 0
-    HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
-    HAL_SPI_Transmit(&hspi1, &controlByte, 1, HAL_MAX_DELAY);                 // Send control byte
-    HAL_SPI_Transmit(&hspi1, &data, 1, HAL_MAX_DELAY);                        // Send data byte
-    HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
-}
-
-// Read Status Register
-uint8_t ReadStatus(void) {
-    uint8_t controlByte = 0x40; // A0 = 0, RW = 1
-    uint8_t status = 0x00;      // Variable to hold the status byte
+static inline uint8_t LT7680_HalRead(uint8_t controlByte) {
+    uint8_t data = 0x00;
     HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
 
     // Attempt SPI transmit and receive
     if (HAL_SPI_Transmit(&hspi1, &controlByte, 1, HAL_MAX_DELAY) == HAL_OK &&
-        HAL_SPI_Receive(&hspi1, &status, 1, HAL_MAX_DELAY) == HAL_OK) {
+        HAL_SPI_Receive(&hspi1, &data, 1, HAL_MAX_DELAY) == HAL_OK) {
         LT7680_SPI_Read_ok = 1; // SPI read was successful
     }
     else {
@@ -88,26 +143,605 @@ uint8_t ReadStatus(void) {
     }
 
     HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
-    return status;
+    return data;
+}
+
+static inline void LT7680_LlWaitIdle(void) {
+    while (!(SPI1->SR & SPI_SR_TXE));
+    while (SPI1->SR & SPI_SR_BSY);
+    (void)SPI1->DR;                 // Drop the byte clocked in while sending, DR then SR read clears OVR
+    (void)SPI1->SR;
+}
+
+static inline void LT7680_LlWrite(const uint8_t* bytes, uint8_t len) {
+    SPI1->CR1 |= SPI_CR1_SPE;       // HAL_SPI_Init() leaves the peripheral disabled
+    LT7680_CS_LOW();
+#if LT7680_LL_FRAME16
+    for (uint8_t i = 0; i + 1 < len; i += 2) {
+        while (!(SPI1->SR & SPI_SR_TXE));
+        SPI1->DR = (uint16_t)((bytes[i] << 8) | bytes[i + 1]);     // Control + payload, MSB first
+    }
+#else
+    for (uint8_t i = 0; i < len; i++) {
+        while (!(SPI1->SR & SPI_SR_TXE));
+        SPI1->DR = bytes[i];
+    }
+#endif
+    LT7680_LlWaitIdle();
+    LT7680_CS_HIGH();
+}
+
+// Bounded wait for an SR flag to reach 'state', 0 on timeout
+static inline uint8_t LT7680_LlWaitFlag(uint32_t flag, uint32_t state) {
+    uint32_t spin = LT7680_LL_SPIN_MAX;
+    while ((SPI1->SR & flag) != state) {
+        if (--spin == 0) return 0;
+    }
+    return 1;
+}
+
+// One byte in flight at a time: each byte is sent only after the previous reply has been read, so a
+// preemption between the two (TIM3, capture DMA) can never leave a second byte behind RXNE and set OVR.
+static inline uint8_t LT7680_LlRead(uint8_t controlByte) {
+    uint8_t data = 0x00;
+    uint8_t ok;
+
+    SPI1->CR1 |= SPI_CR1_SPE;
+    while (SPI1->SR & SPI_SR_RXNE) (void)SPI1->DR;     // Nothing stale in front of the reply
+    LT7680_CS_LOW();
+#if LT7680_LL_FRAME16
+    SPI1->DR = (uint16_t)(controlByte << 8);            // Control out, reply clocked in the low byte
+    ok = LT7680_LlWaitFlag(SPI_SR_RXNE, SPI_SR_RXNE);
+    if (ok) data = (uint8_t)SPI1->DR;
+#else
+    SPI1->DR = controlByte;
+    ok = LT7680_LlWaitFlag(SPI_SR_RXNE, SPI_SR_RXNE);
+    if (ok) {
+        (void)SPI1->DR;                                 // Byte received during the control byte
+        SPI1->DR = 0x00;                                // Dummy byte clocks the reply in
+        ok = LT7680_LlWaitFlag(SPI_SR_RXNE, SPI_SR_RXNE);
+        if (ok) data = (uint8_t)SPI1->DR;
+    }
+#endif
+    ok &= LT7680_LlWaitFlag(SPI_SR_BSY, 0);
+    LT7680_CS_HIGH();
+    if (SPI1->SR & SPI_SR_OVR) {
+        (void)SPI1->DR;                                 // DR then SR read clears OVR, as the HAL does
+        (void)SPI1->SR;
+        ok = 0;
+    }
+    LT7680_SPI_Read_ok = ok;
+    return data;
+}
+
+#if LT7680_SPI_DRIVER == LT7680_DRV_LL
+#define LT7680_SpiWrite     LT7680_LlWrite
+#define LT7680_SpiRead      LT7680_LlRead
+#else
+#define LT7680_SpiWrite     LT7680_HalWrite
+#define LT7680_SpiRead      LT7680_HalRead
+#endif
+
+
+//**************************************************************************************************
+// Core commands
+
+#if LT7680_ASYNC_QUEUE
+static void LT7680_QueueXfer(const uint8_t* bytes, uint8_t len);
+static void LT7680_QueueFence(void);
+static uint8_t lt7680QueueEnabled = 0;          // 0 during boot, everything goes out blocking
+#define LT7680_QUEUED()     (lt7680QueueEnabled)
+#else
+#define LT7680_QUEUED()     (0)
+#endif
+
+// One CS assertion carrying 'len' bytes, queued for DMA once LT7680_QueueEnable() has been called
+static void LT7680_Send(const uint8_t* bytes, uint8_t len) {
+#if LT7680_ASYNC_QUEUE
+    if (LT7680_QUEUED()) {
+        LT7680_QueueXfer(bytes, len);
+        return;
+    }
+#endif
+    LT7680_SpiWrite(bytes, len);
+    lt7680SpiBytes += len;
+    lt7680SpiXfers++;
+}
+
+// Write Register Address
+void WriteRegister(uint8_t reg) {
+    lt7680SelectedReg = reg;
+#if LT7680_SPI_TRANSPORT == LT7680_XFER_BYTE
+    if (!LT7680_QUEUED()) {
+        uint8_t controlByte = 0x00; // A0 = 0, RW = 0
+        HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
+        HAL_SPI_Transmit(&hspi1, &controlByte, 1, HAL_MAX_DELAY);                 // Send control byte
+        HAL_SPI_Transmit(&hspi1, &reg, 1, HAL_MAX_DELAY);                         // Send register address
+        lt7680SpiBytes += 2;                                        // Control byte + one byte
+        lt7680SpiXfers++;
+        HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
+        return;
+    }
+#endif
+    uint8_t frame[2] = { 0x00, reg };                           // A0 = 0, RW = 0 + register address
+    LT7680_Send(frame, 2);
+}
+
+// Write Data
+void WriteData(uint8_t data) {
+    // Keep the shadow in step with every write, including raw WriteRegister()/WriteData() pairs
+    LT7680_ShadowStore(lt7680SelectedReg, data);
+
+#if LT7680_SPI_TRANSPORT == LT7680_XFER_BYTE
+    if (!LT7680_QUEUED()) {
+        uint8_t controlByte = 0x80; // A0 = 1, RW = 0
+        HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
+        HAL_SPI_Transmit(&hspi1, &controlByte, 1, HAL_MAX_DELAY);                 // Send control byte
+        HAL_SPI_Transmit(&hspi1, &data, 1, HAL_MAX_DELAY);                        // Send data byte
+        lt7680SpiBytes += 2;                                        // Control byte + one byte
+        lt7680SpiXfers++;
+        HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
+        return;
+    }
+#endif
+    uint8_t frame[2] = { 0x80, data };                          // A0 = 1, RW = 0 + data byte
+    LT7680_Send(frame, 2);
+}
+
+// Read Status Register - blocking, never queued
+static uint8_t LT7680_ReadStatusNow(void) {
+    lt7680SpiBytes += 2;                                        // Control byte + one byte
+    lt7680SpiXfers++;
+    return LT7680_SpiRead(0x40);                                // A0 = 0, RW = 1
+}
+
+#if LT7680_ASYNC_QUEUE || LT7680_DISPLAY_PAGES > 1
+// Select 'reg' and read it back, no fence and no shadow update (queued status waits, SPI1 idle)
+static uint8_t LT7680_ReadRegisterNow(uint8_t reg) {
+    const uint8_t select[2] = { 0x00, reg };                    // A0 = 0, RW = 0 + register address
+
+    LT7680_SpiWrite(select, 2);
+    lt7680SpiBytes += 4;                                        // Select + read, control byte + one byte each
+    lt7680SpiXfers += 2;
+    return LT7680_SpiRead(0xC0);                                // A0 = 1, RW = 1
+}
+#endif
+
+// Read Status Register
+uint8_t ReadStatus(void) {
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueFence();        // Status must reflect everything written before it
+#endif
+    return LT7680_ReadStatusNow();
 }
 
 // Read Data from Register
 uint8_t ReadData(void) {
-    uint8_t controlByte = 0xC0; // A0 = 1, RW = 1
-    uint8_t data = 0x00; // Variable to hold the data byte
-    HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
-    HAL_SPI_Transmit(&hspi1, &controlByte, 1, HAL_MAX_DELAY);                 // Send control byte
-    HAL_SPI_Receive(&hspi1, &data, 1, HAL_MAX_DELAY);                         // Read data byte
-    HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
-    return data;
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueFence();        // Register select and any pending writes must be out first
+#endif
+    lt7680SpiBytes += 2;                                        // Control byte + one byte
+    lt7680SpiXfers++;
+    return LT7680_SpiRead(0xC0);                                // A0 = 1, RW = 1
 }
 
-// Write Register Address and Data (combined) - optional
+// Write Register Address and Data (combined)
+// Skipped when the register already holds 'value', unless it is marked in lt7680RegVolatile[]
 void WriteDataToRegister(uint8_t reg, uint8_t value) {
+    if (LT7680_ShadowHit(reg, value)) {
+        lt7680RegWritesSuppressed++;
+        return;
+    }
+
+    lt7680RegWritesIssued++;
     WriteRegister(reg); // Write the register address
     WriteData(value);   // Write the data to the register
 }
 
+// Write a sequence of register/value pairs { reg, value, reg, value, ... } as one SPI burst
+// Pairs already held by the register shadow are dropped first, order of the rest is kept (triggers go last)
+//   LT7680_XFER_BYTE  - WriteRegister()/WriteData() per pair, 4 HAL calls and 2 CS cycles per register
+//   LT7680_XFER_PAIR  - one 2 byte transfer per CS cycle, 2 HAL calls per register
+//   LT7680_XFER_BURST - whole sequence in one transfer, CS held low across it
+void WriteRegisterBurst(const uint8_t* regValues, uint8_t pairs) {
+    uint8_t buf[4 * LT7680_BURST_MAX_PAIRS];
+    uint8_t len = 0;
+
+    if (pairs > LT7680_BURST_MAX_PAIRS) pairs = LT7680_BURST_MAX_PAIRS;
+
+    for (uint8_t i = 0; i < pairs; i++) {
+        uint8_t reg = regValues[2 * i];
+        uint8_t value = regValues[2 * i + 1];
+
+        if (LT7680_ShadowHit(reg, value)) {
+            lt7680RegWritesSuppressed++;
+            continue;
+        }
+        lt7680RegWritesIssued++;
+
+#if LT7680_SPI_TRANSPORT == LT7680_XFER_BYTE
+        WriteRegister(reg);
+        WriteData(value);
+#else
+        LT7680_ShadowStore(reg, value);
+        buf[len++] = 0x00;      // A0 = 0, RW = 0
+        buf[len++] = reg;
+        buf[len++] = 0x80;      // A0 = 1, RW = 0
+        buf[len++] = value;
+        lt7680SelectedReg = reg;
+#endif
+    }
+
+    if (len == 0) return;
+
+#if LT7680_SPI_TRANSPORT == LT7680_XFER_BURST
+    LT7680_Send(buf, len);
+#else
+    for (uint8_t k = 0; k < len; k += 2) {
+        LT7680_Send(&buf[k], 2);
+    }
+#endif
+}
+
+
+//**************************************************************************************************
+// SPI1 clock calibration
+//
+// MX_SPI1_Init() starts at 9MHz, which the LT7680 accepts before its PLL is up. Once SendAllToLT7680_LT()
+// has run, step 36/18/9MHz and write/read back patterns on the text colour registers (D2h-D7h, plain
+// R/W with no side effects). The fastest step with no errors gets a longer soak, then the clock is
+// set LT7680_SPI_TUNE_BACKOFF steps slower than that for margin (never slower than 9MHz).
+// The STM32F103 datasheet (SPI characteristics, fSCK master mode) allows 18MHz at most: 36MHz is only
+// probed for margin, it can never be the final clock while the backoff is at least one step.
+
+#if LT7680_SPI_TUNE_BACKOFF < 1
+#error "LT7680_SPI_TUNE_BACKOFF must be >= 1, the 36MHz step is above the STM32F103 18MHz SPI master limit"
+#endif
+#if defined(LT7680_SPI_PRESCALER) && (LT7680_SPI_PRESCALER == SPI_BAUDRATEPRESCALER_2)
+#error "LT7680_SPI_PRESCALER: SPI_BAUDRATEPRESCALER_2 is 36MHz, above the STM32F103 18MHz SPI master limit"
+#endif
+
+volatile LT7680_SpiTuneDiag lt7680SpiTune;      // Live Watch: chosen clock and errors per step
+
+static const uint32_t lt7680SpiSteps[3] = {
+    SPI_BAUDRATEPRESCALER_2,                    // 36MHz (PCLK2 72MHz), out of spec, margin probe only
+    SPI_BAUDRATEPRESCALER_4,                    // 18MHz
+    SPI_BAUDRATEPRESCALER_8,                    // 9MHz, the original setting
+};
+
+static void LT7680_SpiSetPrescaler(uint32_t prescaler) {
+    hspi1.Init.BaudRatePrescaler = prescaler;
+    if (HAL_SPI_Init(&hspi1) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    lt7680SpiTune.prescaler = prescaler;
+    lt7680SpiTune.spiClockHz = HAL_RCC_GetPCLK2Freq() >> (((prescaler >> SPI_CR1_BR_Pos) & 0x7) + 1);
+}
+
+// Write/read back 'patterns' values on each scratch register, returns the number of mismatches
+static uint32_t LT7680_SpiPatternTest(uint8_t step, uint32_t patterns) {
+    uint32_t errors = 0;
+
+    for (uint32_t n = 0; n < patterns; n++) {
+        for (uint8_t reg = 0xD2; reg <= 0xD7; reg++) {
+            uint8_t pattern;
+            switch (n & 3) {
+            case 0:  pattern = 0x55; break;
+            case 1:  pattern = 0xAA; break;
+            case 2:  pattern = (uint8_t)(1u << ((n + reg) & 7)); break;     // walking one
+            default: pattern = (uint8_t)(n * 37u + reg); break;
+            }
+
+            WriteRegister(reg);
+            WriteData(pattern);
+            WriteRegister(reg);
+            if (ReadData() != pattern) errors++;
+        }
+    }
+
+    lt7680SpiTune.tests[step] += patterns * 6;
+    lt7680SpiTune.errors[step] += errors;
+    return errors;
+}
+
+void LT7680_SpiAutoTune(void) {
+    memset((void*)&lt7680SpiTune, 0, sizeof(lt7680SpiTune));
+    lt7680SpiTune.fastestPassStep = 0xFF;
+
+#ifdef LT7680_SPI_PRESCALER
+    lt7680SpiTune.overridden = 1;
+    lt7680SpiTune.chosenStep = 0xFF;
+    LT7680_SpiSetPrescaler(LT7680_SPI_PRESCALER);
+#else
+    // Save the colours at the known good boot clock
+    uint8_t saved[6];
+    for (uint8_t i = 0; i < 6; i++) {
+        WriteRegister(0xD2 + i);
+        saved[i] = ReadData();
+    }
+
+    uint8_t slowest = sizeof(lt7680SpiSteps) / sizeof(lt7680SpiSteps[0]) - 1;
+    uint8_t chosen = slowest;
+
+    for (uint8_t step = 0; step <= slowest; step++) {
+        LT7680_SpiSetPrescaler(lt7680SpiSteps[step]);
+        if (LT7680_SpiPatternTest(step, LT7680_SPI_TUNE_PATTERNS) != 0) continue;
+        if (LT7680_SpiPatternTest(step, LT7680_SPI_TUNE_PATTERNS * LT7680_SPI_TUNE_SOAK) != 0) continue;
+
+        lt7680SpiTune.fastestPassStep = step;
+        chosen = step + LT7680_SPI_TUNE_BACKOFF;
+        if (chosen > slowest) chosen = slowest;
+        break;
+    }
+
+    lt7680SpiTune.chosenStep = chosen;
+    LT7680_SpiSetPrescaler(lt7680SpiSteps[chosen]);
+
+    for (uint8_t i = 0; i < 6; i++) {
+        WriteRegister(0xD2 + i);
+        WriteData(saved[i]);
+    }
+#endif
+}
+
+//**************************************************************************************************
+// Render profiling - what one call cost on the wire, without a scope
+// Bytes and CS transactions are counted where they are sent (or queued), bus time is modelled from the
+// SPI1 clock currently programmed (bytes x 8 / f), so the figures follow LT7680_SpiAutoTune().
+
+void LT7680_ProfileEnd(volatile LT7680_RenderProfile* prof, uint32_t bytes0, uint32_t xfers0) {
+    uint32_t bytes = lt7680SpiBytes - bytes0;
+    uint32_t spiHz = HAL_RCC_GetPCLK2Freq() >> (((SPI1->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos) + 1);
+
+    prof->calls++;
+    prof->lastBytes = bytes;
+    prof->lastXfers = lt7680SpiXfers - xfers0;
+    prof->lastBusUs = (uint32_t)(((uint64_t)bytes * 8u * 1000000u) / spiHz);
+    if (prof->lastBusUs > prof->maxBusUs) prof->maxBusUs = prof->lastBusUs;
+    prof->totalBytes += bytes;
+}
+
+
+//**************************************************************************************************
+// SPI1 transport microbenchmark - HAL vs LL on the target, LT7680_SPI_BENCH = 1 runs it once at boot
+// Sends register selects of D2h (no side effect) back to back, timed with the DWT cycle counter.
+
+#if LT7680_SPI_BENCH
+volatile LT7680_SpiBenchResult lt7680SpiBench;  // Live Watch
+
+static uint32_t LT7680_BenchRate(uint32_t count, uint32_t cycles) {
+    return cycles ? (uint32_t)(((uint64_t)count * SystemCoreClock) / cycles) : 0;
+}
+
+void LT7680_SpiBenchmark(void) {
+    const uint8_t frame[2] = { 0x00, 0xD2 };   // A0 = 0, RW = 0 + register address
+    uint32_t t0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    lt7680SpiBench.spiClockHz = lt7680SpiTune.spiClockHz;
+
+#if !LT7680_LL_FRAME16
+    t0 = DWT->CYCCNT;
+    for (uint32_t i = 0; i < LT7680_SPI_BENCH_COUNT; i++) LT7680_HalWrite(frame, 2);
+    uint32_t halCycles = DWT->CYCCNT - t0;
+    lt7680SpiBench.halXfersPerSec = LT7680_BenchRate(LT7680_SPI_BENCH_COUNT, halCycles);
+    lt7680SpiBench.halBytesPerSec = LT7680_BenchRate(2 * LT7680_SPI_BENCH_COUNT, halCycles);
+#endif
+
+    t0 = DWT->CYCCNT;
+    for (uint32_t i = 0; i < LT7680_SPI_BENCH_COUNT; i++) LT7680_LlWrite(frame, 2);
+    uint32_t llCycles = DWT->CYCCNT - t0;
+    lt7680SpiBench.llXfersPerSec = LT7680_BenchRate(LT7680_SPI_BENCH_COUNT, llCycles);
+    lt7680SpiBench.llBytesPerSec = LT7680_BenchRate(2 * LT7680_SPI_BENCH_COUNT, llCycles);
+
+    lt7680SelectedReg = 0xD2;
+    lt7680SpiBytes += 4 * LT7680_SPI_BENCH_COUNT;
+    lt7680SpiXfers += 2 * LT7680_SPI_BENCH_COUNT;
+}
+#endif
+
+//**************************************************************************************************
+// Asynchronous command queue - SPI1 TX on DMA1 Channel 3
+//
+// Once enabled, writes are queued as CS transactions and DMA sends them in the background, so the
+// renderer returns as soon as a frame is queued. Entries in lt7680Queue[]:
+//   [len 1..LT7680_QUEUE_MAX_XFER][len bytes]   one CS assertion, HAL_SPI_Transmit_DMA(), longer transfers are split
+//   [LT7680_Q_WAIT][mask][expect]               wait for (STSR & mask) == expect, one STSR read per DMA IRQ,
+//                                               retried from SysTick (LT7680_QueueTick()) while the LT7680 is busy
+//   [LT7680_Q_WAIT_REG][reg][mask][expect]      the same on register 'reg' (INTF Vsync flag before a page flip)
+//   [LT7680_Q_WRAP]                             rest of the ring unused, carry on at index 0
+// Entries never straddle the end of the ring, so every DMA transfer is one contiguous block.
+// ReadStatus()/ReadData() are fences: they wait for the queue to drain before reading.
+
+#if LT7680_ASYNC_QUEUE
+#define LT7680_Q_WRAP       0x00
+#define LT7680_Q_WAIT       0xFF
+#define LT7680_Q_WAIT_REG   0xFE
+
+// Everything sent in one CS transaction has to fit one entry, or LT7680_QueueXfer() splits it
+#if LT7680_TEXT_CHUNK + 1 > LT7680_QUEUE_MAX_XFER
+#error "LT7680_TEXT_CHUNK + 1 (a DrawText() chunk) must fit LT7680_QUEUE_MAX_XFER"
+#endif
+#if 4 * LT7680_BURST_MAX_PAIRS > LT7680_QUEUE_MAX_XFER
+#error "4 * LT7680_BURST_MAX_PAIRS (a WriteRegisterBurst() sequence) must fit LT7680_QUEUE_MAX_XFER"
+#endif
+#if LT7680_QUEUE_MAX_XFER >= LT7680_Q_WAIT_REG
+#error "LT7680_QUEUE_MAX_XFER must stay below the queue entry markers"
+#endif
+
+static uint8_t lt7680Queue[LT7680_QUEUE_SIZE];
+static volatile uint16_t lt7680QueueHead = 0;   // next free byte, only moved by the renderer
+static volatile uint16_t lt7680QueueTail = 0;   // next entry to send, only moved by the DMA IRQ
+static volatile uint8_t lt7680QueueInFlight = 0; // entry size of the DMA transfer running, 0 = idle
+static volatile uint8_t lt7680QueueWaiting = 0; // parked on a LT7680_Q_WAIT entry, SysTick re-pends the IRQ
+static uint32_t lt7680QueueWaitStart;           // uwTick when the parked wait started
+
+volatile uint32_t lt7680QueueHighWater = 0;     // Live Watch: most bytes ever waiting in the queue
+volatile uint32_t lt7680QueueStalls = 0;        // Live Watch: enqueues that had to wait for space
+volatile uint32_t lt7680QueueFences = 0;        // Live Watch: reads that had to drain a non-empty queue
+volatile uint32_t lt7680QueueWaitRetries = 0;   // Live Watch: LT7680_Q_WAIT found the LT7680 busy and parked
+
+static uint16_t LT7680_QueueUsed(void) {
+    return (uint16_t)((lt7680QueueHead - lt7680QueueTail + LT7680_QUEUE_SIZE) % LT7680_QUEUE_SIZE);
+}
+
+// Start the next entry, only ever runs in the DMA1 Channel 3 IRQ with the DMA idle
+static void LT7680_QueueNext(void) {
+    uint16_t tail = lt7680QueueTail;
+
+    while (tail != lt7680QueueHead) {
+        uint8_t op = lt7680Queue[tail];
+
+        if (op == LT7680_Q_WRAP) {
+            tail = 0;
+        }
+        else if (op == LT7680_Q_WAIT || op == LT7680_Q_WAIT_REG) {
+            uint8_t size = (op == LT7680_Q_WAIT) ? 3 : 4;
+            uint8_t mask = lt7680Queue[tail + size - 2];
+            uint8_t expect = lt7680Queue[tail + size - 1];
+            uint8_t value = (op == LT7680_Q_WAIT) ? LT7680_ReadStatusNow() : LT7680_ReadRegisterNow(lt7680Queue[tail + 1]);
+
+            // One read, never a spin in the IRQ. Not there yet: stay on the entry, SysTick pends the IRQ again.
+            if ((value & mask) != expect) {
+                if (!lt7680QueueWaiting) {
+                    lt7680QueueWaiting = 1;
+                    lt7680QueueWaitStart = uwTick;
+                }
+                if (uwTick - lt7680QueueWaitStart < LT7680_WAIT_TIMEOUT_MS) {
+                    lt7680QueueWaitRetries++;
+                    lt7680QueueTail = tail;
+                    return;
+                }
+                lt7680WaitTimeouts++;           // Carry on as the blocking wait does when it times out
+            }
+            lt7680QueueWaiting = 0;
+            tail = (uint16_t)((tail + size) % LT7680_QUEUE_SIZE);
+        }
+        else {
+            lt7680QueueTail = tail;
+            lt7680QueueInFlight = (uint8_t)(op + 1);
+            HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_RESET); // CS Low
+            HAL_SPI_Transmit_DMA(&hspi1, &lt7680Queue[tail + 1], op);
+            return;
+        }
+    }
+
+    lt7680QueueTail = tail;
+}
+
+// SPI1 TX DMA complete - called from HAL_SPI_TxCpltCallback() once the last bit is out (BSY clear)
+void LT7680_QueueTxComplete(void) {
+    if (!lt7680QueueInFlight) return;
+
+    HAL_GPIO_WritePin(SPI_CS_PORT, SPI_CS_PIN, GPIO_PIN_SET);   // CS High
+    lt7680QueueTail = (uint16_t)((lt7680QueueTail + lt7680QueueInFlight) % LT7680_QUEUE_SIZE);
+    lt7680QueueInFlight = 0;
+    LT7680_QueueNext();
+}
+
+// DMA1 Channel 3 IRQ - restarts the queue after LT7680_QueueKick(), TC flags are handled by HAL first
+void LT7680_QueueService(void) {
+    if (!lt7680QueueInFlight) LT7680_QueueNext();
+}
+
+// SysTick - retry a parked LT7680_Q_WAIT once per millisecond
+void LT7680_QueueTick(void) {
+    if (lt7680QueueWaiting) NVIC_SetPendingIRQ(DMA1_Channel3_IRQn);
+}
+
+// Queue consumer is the DMA IRQ only, so the renderer just pends it (same as DMM_CaptureService)
+static void LT7680_QueueKick(void) {
+    if (!lt7680QueueInFlight) NVIC_SetPendingIRQ(DMA1_Channel3_IRQn);
+}
+
+// Reserve 'size' contiguous bytes, waiting for the DMA if the ring is full. Returns the start index.
+static uint16_t LT7680_QueueReserve(uint8_t size) {
+    uint8_t stalled = 0;
+
+    for (;;) {
+        uint16_t head = lt7680QueueHead;
+        uint16_t tail = lt7680QueueTail;
+
+        if (head >= tail) {
+            // Free space is [head, end) and [0, tail - 1), one byte always stays empty so full != empty
+            if (LT7680_QUEUE_SIZE - head > size || (LT7680_QUEUE_SIZE - head == size && tail != 0)) {
+                return head;
+            }
+            if (tail > size) {
+                lt7680Queue[head] = LT7680_Q_WRAP;
+                return 0;
+            }
+        }
+        else if (tail - head > size) {
+            return head;
+        }
+
+        if (!stalled) {
+            stalled = 1;
+            lt7680QueueStalls++;
+        }
+        LT7680_QueueKick();     // Ring full, let the DMA make room
+    }
+}
+
+static void LT7680_QueueCommit(uint16_t start, uint8_t size) {
+    __DMB();                    // Entry bytes visible before the IRQ can see the new head
+    lt7680QueueHead = (uint16_t)((start + size) % LT7680_QUEUE_SIZE);
+
+    uint16_t used = LT7680_QueueUsed();
+    if (used > lt7680QueueHighWater) lt7680QueueHighWater = used;
+
+    LT7680_QueueKick();
+}
+
+// One CS transaction entry, 'stream' = 1 puts a 0x80 (data write) in front of the 'len' bytes
+static void LT7680_QueueEntry(uint8_t stream, const uint8_t* bytes, uint8_t len) {
+    uint8_t size = (uint8_t)(stream + len);
+
+    uint16_t start = LT7680_QueueReserve((uint8_t)(size + 1));
+    lt7680Queue[start] = size;
+    if (stream) lt7680Queue[start + 1] = 0x80;
+    memcpy(&lt7680Queue[start + 1 + stream], bytes, len);
+    lt7680SpiBytes += size;
+    lt7680SpiXfers++;
+    LT7680_QueueCommit(start, (uint8_t)(size + 1));
+}
+
+// A transfer longer than LT7680_QUEUE_MAX_XFER (none today, see the checks above) goes out as several CS
+// transactions: a 0x80 data stream carries on with its own 0x80 in each, anything else is cut on whole
+// control/data byte pairs (the selected register holds across CS)
+static void LT7680_QueueXfer(const uint8_t* bytes, uint8_t len) {
+    const uint8_t stream = (bytes[0] == 0x80);
+    const uint8_t pairsMax = LT7680_QUEUE_MAX_XFER & ~1;
+    uint8_t n = (len > LT7680_QUEUE_MAX_XFER) ? pairsMax : len;
+
+    LT7680_QueueEntry(0, bytes, n);
+    for (bytes += n, len -= n; len > 0; bytes += n, len -= n) {
+        uint8_t max = stream ? LT7680_QUEUE_MAX_XFER - 1 : pairsMax;
+        n = (len > max) ? max : len;
+        LT7680_QueueEntry(stream, bytes, n);
+    }
+}
+
+// Wait until every queued entry has been sent, SPI1 is then free for a blocking read
+static void LT7680_QueueFence(void) {
+    if (lt7680QueueHead == lt7680QueueTail && !lt7680QueueInFlight) return;
+
+    lt7680QueueFences++;
+    LT7680_QueueKick();
+    while (lt7680QueueHead != lt7680QueueTail || lt7680QueueInFlight);
+}
+
+// Switch LT7680 writes between blocking (boot, 0) and DMA queued (1). Drains the queue before disabling.
+void LT7680_QueueEnable(uint8_t enable) {
+    if (!enable) LT7680_QueueFence();
+    lt7680QueueEnabled = enable;
+}
+#endif
+
 
 //**************************************************************************************************
 // Subs to run and sent to the LT7680
@@ -169,7 +803,7 @@ void SendAllToLT7680_LT() {
     HAL_Delay(5);
    
     Text_Mode();
-    ClearScreen();                          // Draws black 'spaces' across the whole screen - fast
+    ClearScreen();                          // BTE solid fill of the whole canvas in black
 
      
 }
@@ -204,9 +838,6 @@ void ConfigureFontAndPosition(uint8_t fontSource, uint8_t characterHeight, uint8
     ccr0 |= ((characterHeight & 0b11) << 4);    // Character height
     ccr0 |= (isoCoding & 0b11);                 // ISO coding
 
-    WriteRegister(0xCC); // Write to CCR0
-    WriteData(ccr0);
-
     // Configure CCR1 (REG[CDh])
     ccr1 |= (fullAlignment << 7);               // Full alignment
     ccr1 |= (chromaKeying << 6);                // Chroma keying
@@ -214,71 +845,34 @@ void ConfigureFontAndPosition(uint8_t fontSource, uint8_t characterHeight, uint8
     ccr1 |= ((widthFactor & 0b11) << 2);        // Character width enlargement
     ccr1 |= (heightFactor & 0b11);              // Character height enlargement
 
-    WriteRegister(0xCD); // Write to CCR1
-    WriteData(ccr1);
-
-    // Configure Character Line Gap (REG[D0h])
-    WriteRegister(0xD0);
-    WriteData(lineGap & 0x1F); // Line gap (5 bits)
-
-    // Configure Character-to-Character Space (REG[D1h])
-    WriteRegister(0xD1);
-    WriteData(charSpacing & 0x3F); // Character spacing (6 bits)
-
-    // Set Cursor Position
-    WriteRegister(0x63); // X lower byte
-    WriteData(cursorX & 0xFF);
-    WriteRegister(0x64); // X upper byte
-    WriteData((cursorX >> 8) & 0x1F);
-
-    WriteRegister(0x65); // Y lower byte
-    WriteData(cursorY & 0xFF);
-    WriteRegister(0x66); // Y upper byte
-    WriteData((cursorY >> 8) & 0x1F);
+    DMM_CYCLES_BEGIN();
+
+    const uint8_t regs[] = {
+        0xCC, ccr0,                         // CCR0
+        0xCD, ccr1,                         // CCR1
+        0xD0, lineGap & 0x1F,               // Character Line Gap (5 bits)
+        0xD1, charSpacing & 0x3F,           // Character-to-Character Space (6 bits)
+        0x63, cursorX & 0xFF,               // Cursor X lower byte
+        0x64, (cursorX >> 8) & 0x1F,        // Cursor X upper byte
+        0x65, cursorY & 0xFF,               // Cursor Y lower byte
+        0x66, (cursorY >> 8) & 0x1F,        // Cursor Y upper byte
+    };
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+
+    DMM_STAT(uint32_t cycles; DMM_CYCLES_END(cycles, cycles);
+             lt7680FontCallUs = LT7680_CALL_US(cycles);
+             if (lt7680FontCallUs > lt7680FontCallUsMax) lt7680FontCallUsMax = lt7680FontCallUs);
 }
 
 
+// Clear the whole canvas to black with one BTE solid fill
+// Was 3600 single space characters through the text engine, now ~20 register writes and one engine wait
 void ClearScreen() {
-    uint16_t charWidth = 8;      // Character width in pixels
-    uint16_t charHeight = 16;    // Character height in pixels
-
-    SetTextColors(0x000000, 0x000000); // foreground, background = black
-
-    // Configure the font and position once
-    ConfigureFontAndPosition(
-        0b00,    // Internal CGROM
-        0b00,    // Font size
-        0b00,    // ISO 8859-1
-        0,       // Full alignment disabled
-        0,       // Chroma keying disabled
-        1,       // Rotate 90 degrees counterclockwise
-        0b01,    // Width X1
-        0b01,    // Height X1
-        0,       // Line spacing
-        0,       // Char spacing
-        0,       // Cursor X
-        0        // Cursor Y
-    );
-
-    // Iterate through rows and columns
-    for (uint16_t y = 0; y < LCD_YSIZE_TFT; y += charWidth) {   // In rotation, width becomes Y step
-        for (uint16_t x = 0; x < LCD_XSIZE_TFT; x += charHeight) { // In rotation, height becomes X step
-            // Set cursor position
-            WriteRegister(0x63); // X lower byte
-            WriteData(x & 0xFF);
-            WriteRegister(0x64); // X upper byte
-            WriteData((x >> 8) & 0x1F);
-
-            WriteRegister(0x65); // Y lower byte
-            WriteData(y & 0xFF);
-            WriteRegister(0x66); // Y upper byte
-            WriteData((y >> 8) & 0x1F);
-
-            // Print the character
-            DrawText(" ");
-        }
-    }
+    LT7680_PROFILE_BEGIN();
 
+    FillRect(0, 0, LCD_XSIZE_TFT, LCD_YSIZE_TFT, 0x000000);
+
+    LT7680_PROFILE_END(lt7680ProfClearScreen);
 }
 
 
@@ -299,19 +893,105 @@ void DrawTextChunks(char* text) {
 }
 
 
+// Wait until (STSR & mask) == expect. Queued behind any pending writes when the command queue is on,
+// the DMA IRQ checks it in order (see LT7680_QueueNext()) and the caller carries on. Otherwise (boot,
+// LT7680_ASYNC_QUEUE 0) it polls here in thread context, never from an interrupt, bounded in time.
+static void LT7680_WaitStatus(uint8_t mask, uint8_t expect)
+{
+#if LT7680_ASYNC_QUEUE
+    if (LT7680_QUEUED()) {
+        uint16_t start = LT7680_QueueReserve(3);
+        lt7680Queue[start] = LT7680_Q_WAIT;
+        lt7680Queue[start + 1] = mask;
+        lt7680Queue[start + 2] = expect;
+        LT7680_QueueCommit(start, 3);
+        return;
+    }
+#endif
+
+    uint32_t start = HAL_GetTick();
+
+    while ((LT7680_ReadStatusNow() & mask) != expect) {    // STSR
+        if (HAL_GetTick() - start >= LT7680_WAIT_TIMEOUT_MS) {
+            lt7680WaitTimeouts++;
+            break;
+        }
+    }
+}
+
+
+#if LT7680_DISPLAY_PAGES > 1
+// Wait until (register 'reg' & mask) == expect, queued like LT7680_WaitStatus(). Leaves 'reg' selected.
+static void LT7680_WaitRegister(uint8_t reg, uint8_t mask, uint8_t expect)
+{
+    lt7680SelectedReg = reg;
+#if LT7680_ASYNC_QUEUE
+    if (LT7680_QUEUED()) {
+        uint16_t start = LT7680_QueueReserve(4);
+        lt7680Queue[start] = LT7680_Q_WAIT_REG;
+        lt7680Queue[start + 1] = reg;
+        lt7680Queue[start + 2] = mask;
+        lt7680Queue[start + 3] = expect;
+        LT7680_QueueCommit(start, 4);
+        return;
+    }
+#endif
+
+    uint32_t start = HAL_GetTick();
+
+    while ((LT7680_ReadRegisterNow(reg) & mask) != expect) {
+        if (HAL_GetTick() - start >= LT7680_WAIT_TIMEOUT_MS) {
+            lt7680WaitTimeouts++;
+            break;
+        }
+    }
+}
+#endif
+
+
 // DrawText helper
 void WaitForLT7680Ready(void)
 {
-    uint32_t timeout = 100000;
-    uint8_t status;
+    LT7680_WaitStatus(LT7680_STSR_CORE_BUSY, 0);
+}
 
-    do {
-        status = ReadStatus();          // STSR
-    } while ((status & (1 << 3)) && --timeout);
+
+// Draw text with chunked FIFO checking
+// Characters go out back-to-back, LT7680_TEXT_CHUNK at a time. The memory write FIFO is only checked
+// (STSR empty flag) before each chunk and the text engine once at the end, instead of a status round
+// trip before every character. A 14 char MAIN line is 2 status checks rather than 15.
+void DrawText(const char* text)
+{
+    while (*text != '\0') {
+
+        // Whole chunk fits once the write FIFO has drained
+        LT7680_WaitStatus(LT7680_STSR_WR_FIFO_EMPTY, LT7680_STSR_WR_FIFO_EMPTY);
+        lt7680TextChunks++;
+
+        WriteRegister(0x04);                // Register for writing text
+
+#if LT7680_SPI_TRANSPORT == LT7680_XFER_BURST
+        uint8_t buf[1 + LT7680_TEXT_CHUNK];
+        uint8_t len = 0;
+        buf[len++] = 0x80;                  // A0 = 1, RW = 0, then continuous data
+        while (*text != '\0' && len <= LT7680_TEXT_CHUNK) {
+            buf[len++] = (uint8_t)*text++;
+        }
+        LT7680_Send(buf, len);
+#else
+        for (uint8_t n = 0; *text != '\0' && n < LT7680_TEXT_CHUNK; n++) {
+            WriteData((uint8_t)*text++);    // Write each character
+        }
+#endif
+    }
+
+    // Wait until final character has completed
+    WaitForLT7680Ready();
 }
 
 
-// Draw text with LT7680 busy checking - this version no longer requires delays between DrawText() calls
+/*
+// Draw text with LT7680 busy checking - retired, a status round trip before every character
 void DrawText(const char* text)
 {
     while (*text != '\0') {
@@ -328,6 +1008,7 @@ void DrawText(const char* text)
     // Wait until final character has completed
     WaitForLT7680Ready();
 }
+*/
 
 
 // Draw text with FIFO checking
@@ -366,21 +1047,21 @@ void DrawText(char* text) {                                         // simple ve
 
 // Set text colours
 void SetTextColors(uint32_t foreground, uint32_t background) {
-    // Set foreground color
-    WriteRegister(0xD2); // Foreground Red
-    WriteData((foreground >> 16) & 0xFF);
-    WriteRegister(0xD3); // Foreground Green
-    WriteData((foreground >> 8) & 0xFF);
-    WriteRegister(0xD4); // Foreground Blue
-    WriteData(foreground & 0xFF);
-
-    // Set background color
-    WriteRegister(0xD5); // Background Red
-    WriteData((background >> 16) & 0xFF);
-    WriteRegister(0xD6); // Background Green
-    WriteData((background >> 8) & 0xFF);
-    WriteRegister(0xD7); // Background Blue
-    WriteData(background & 0xFF);
+    DMM_CYCLES_BEGIN();
+
+    const uint8_t regs[] = {
+        0xD2, (foreground >> 16) & 0xFF,    // Foreground Red
+        0xD3, (foreground >> 8) & 0xFF,     // Foreground Green
+        0xD4, foreground & 0xFF,            // Foreground Blue
+        0xD5, (background >> 16) & 0xFF,    // Background Red
+        0xD6, (background >> 8) & 0xFF,     // Background Green
+        0xD7, background & 0xFF,            // Background Blue
+    };
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+
+    DMM_STAT(uint32_t cycles; DMM_CYCLES_END(cycles, cycles);
+             lt7680ColorsCallUs = LT7680_CALL_US(cycles);
+             if (lt7680ColorsCallUs > lt7680ColorsCallUsMax) lt7680ColorsCallUsMax = lt7680ColorsCallUs);
 }
 
 
@@ -431,6 +1112,7 @@ void Graphics_Mode()     // - OK
 //******************************************************************************
 // REGISTER CONFIG
 
+// Not used - LT7680_UserFontUpload() sets DBh-DEh to LT7680_CGRAM_ADDR
 void CGRAM_Start_address()
 {
     uint8_t temp = 0x0000;
@@ -445,6 +1127,7 @@ void CGRAM_Start_address()
     WriteData(temp >> 24);
 }
 
+// Not used - the MAIN line selects the user-defined font through ConfigureFontAndPosition() fontSource 10b
 void Font_Select_UserDefine_Mode(void)
 {
     /*[bit7-6]
@@ -469,29 +1152,25 @@ void ConfigureActiveDisplayArea_LT() {
     WriteRegister(0x57); WriteData(0x00);  // X Start High
     WriteRegister(0x58); WriteData(0x00);  // Y Start Low
     WriteRegister(0x59); WriteData(0x00);  // Y Start High
-    WriteRegister(0x5A); WriteData((LCD_XSIZE_TFT - 1) & 0xFF);  // X End Low
-    WriteRegister(0x5B); WriteData(((LCD_XSIZE_TFT - 1) >> 8) & 0xFF);  // X End High
-    WriteRegister(0x5C); WriteData((LCD_YSIZE_TFT - 1) & 0xFF);  // Y End Low
-    WriteRegister(0x5D); WriteData(((LCD_YSIZE_TFT - 1) >> 8) & 0xFF);  // Y End High
+    WriteRegister(0x5A); WriteData(LCD_XSIZE_TFT & 0xFF);  // Width Low (AW_WTH, a size, not an end coordinate)
+    WriteRegister(0x5B); WriteData((LCD_XSIZE_TFT >> 8) & 0x1F);  // Width High
+    WriteRegister(0x5C); WriteData(LCD_YSIZE_TFT & 0xFF);  // Height Low (AW_HT)
+    WriteRegister(0x5D); WriteData((LCD_YSIZE_TFT >> 8) & 0x1F);  // Height High
 }
 
-/*
+// Set text cursor only - font, colours and enlargement stay as configured
 void SetTextCursor(uint16_t x, uint16_t y) {                             // - OK
     // Set X-Coordinate
-    WriteRegister(0x63); // Lower 8 bits of X position
-    WriteData(x & 0xFF);
-    WriteRegister(0x64); // Upper 5 bits of X position
-    WriteData((x >> 8) & 0x1F); // Only bits 12:8 are valid
+    WriteDataToRegister(0x63, x & 0xFF); // Lower 8 bits of X position
+    WriteDataToRegister(0x64, (x >> 8) & 0x1F); // Upper 5 bits of X position - Only bits 12:8 are valid
 
     // Set Y-Coordinate
-    WriteRegister(0x65); // Lower 8 bits of Y position
-    WriteData(y & 0xFF);
-    WriteRegister(0x66); // Upper 5 bits of Y position
-    WriteData((y >> 8) & 0x1F); // Only bits 12:8 are valid
+    WriteDataToRegister(0x65, y & 0xFF); // Lower 8 bits of Y position
+    WriteDataToRegister(0x66, (y >> 8) & 0x1F); // Upper 5 bits of Y position - Only bits 12:8 are valid
 }
 
 
-
+/*
 void DrawText(uint8_t encoding, char *text) {                            // - OK
     // Set the font encoding in Register 0xCC
     uint8_t regValue = (encoding & 0x03); // Encoding occupies Bit 1-0
@@ -1169,44 +1848,31 @@ void DrawLine(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, ui
     //WriteRegister(0x67);
     //WriteData(0x01); // Set bit 0 to start drawing
 
-    // Set the starting point X-coordinate
-    WriteRegister(0x68); // DLHSR[7:0]
-    WriteData(startX & 0xFF);
-    WriteRegister(0x69); // DLHSR[12:8]
-    WriteData((startX >> 8) & 0x1F);
-
-    // Set the starting point Y-coordinate
-    WriteRegister(0x6A); // DLVSR[7:0]
-    WriteData(startY & 0xFF);
-    WriteRegister(0x6B); // DLVSR[12:8]
-    WriteData((startY >> 8) & 0x1F);
-
-    // Set the ending point X-coordinate
-    WriteRegister(0x6C); // DLHER[7:0]
-    WriteData(endX & 0xFF);
-    WriteRegister(0x6D); // DLHER[12:8]
-    WriteData((endX >> 8) & 0x1F);
-
-    // Set the ending point Y-coordinate
-    WriteRegister(0x6E); // DLVER[7:0]
-    WriteData(endY & 0xFF);
-    WriteRegister(0x6F); // DLVER[12:8]
-    WriteData((endY >> 8) & 0x1F);
+    DMM_CYCLES_BEGIN();
 
     // Set line width
     //WriteRegister(0x63); // Line Width Register (Assumed for line width)
     //WriteData(lineWidth);
 
-    // Set line color (Foreground Color Register)
-    WriteRegister(0xD2); // Foreground Color Low Byte
-    WriteData(colorRED);
-    WriteRegister(0xD3); // Foreground Color Low Byte
-    WriteData(colorGREEN);
-    WriteRegister(0xD4); // Foreground Color Low Byte
-    WriteData(colorBLUE);
-
-    WriteRegister(0x67); // Draw Line/Triangle Control Register
-    WriteData(0x80 | 0x00); // Start drawing (bit 7 = 1) and select "Draw Line" (bits 4-1 = 0000)
+    const uint8_t regs[] = {
+        0x68, startX & 0xFF,                // DLHSR[7:0]   start point X
+        0x69, (startX >> 8) & 0x1F,         // DLHSR[12:8]
+        0x6A, startY & 0xFF,                // DLVSR[7:0]   start point Y
+        0x6B, (startY >> 8) & 0x1F,         // DLVSR[12:8]
+        0x6C, endX & 0xFF,                  // DLHER[7:0]   end point X
+        0x6D, (endX >> 8) & 0x1F,           // DLHER[12:8]
+        0x6E, endY & 0xFF,                  // DLVER[7:0]   end point Y
+        0x6F, (endY >> 8) & 0x1F,           // DLVER[12:8]
+        0xD2, colorRED,                     // Line color (Foreground Color Register)
+        0xD3, colorGREEN,
+        0xD4, colorBLUE,
+        0x67, 0x80 | 0x00,                  // Draw Line/Triangle Control Register - Start drawing (bit 7 = 1) and select "Draw Line" (bits 4-1 = 0000)
+    };
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+
+    DMM_STAT(uint32_t cycles; DMM_CYCLES_END(cycles, cycles);
+             lt7680LineCallUs = LT7680_CALL_US(cycles);
+             if (lt7680LineCallUs > lt7680LineCallUsMax) lt7680LineCallUsMax = lt7680LineCallUs);
 
     // Optionally, wait for the drawing to complete (polling)
     //uint8_t drawlineFinished;
@@ -1217,6 +1883,491 @@ void DrawLine(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, ui
 }
 
 
+// Filled rectangle using the LT7680 geometric drawing engine, corners inclusive, colour 0xRRGGBB
+// Much cheaper than overdrawing text: 11 register writes regardless of the area, the LT7680 does the fill
+// Note: leaves the foreground colour (D2-D4) set to 'color', text drawing must call SetTextColors() again
+void DrawFilledRectangle(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint32_t color) {
+
+    WriteDataToRegister(0x68, startX & 0xFF); // DLHSR[7:0]
+    WriteDataToRegister(0x69, (startX >> 8) & 0x1F); // DLHSR[12:8]
+    WriteDataToRegister(0x6A, startY & 0xFF); // DLVSR[7:0]
+    WriteDataToRegister(0x6B, (startY >> 8) & 0x1F); // DLVSR[12:8]
+
+    WriteDataToRegister(0x6C, endX & 0xFF); // DLHER[7:0]
+    WriteDataToRegister(0x6D, (endX >> 8) & 0x1F); // DLHER[12:8]
+    WriteDataToRegister(0x6E, endY & 0xFF); // DLVER[7:0]
+    WriteDataToRegister(0x6F, (endY >> 8) & 0x1F); // DLVER[12:8]
+
+    WriteDataToRegister(0xD2, (color >> 16) & 0xFF); // Foreground Color Red
+    WriteDataToRegister(0xD3, (color >> 8) & 0xFF); // Foreground Color Green
+    WriteDataToRegister(0xD4, color & 0xFF); // Foreground Color Blue
+
+    WriteDataToRegister(0x76, 0x80 | 0x40 | 0x20); // DCR1 - Draw Circle/Ellipse/Square Control Register - Start drawing (bit 7), fill (bit 6), square (bits 5-4 = 10)
+
+    // Wait for the fill to finish before the next text write (STSR core busy covers the draw engine)
+    WaitForLT7680Ready();
+}
+
+
+//**************************************************************************************************
+// Canvas and Block Transfer Engine
+//
+// The text, draw and BTE engines all write to the canvas (CVSSA 50h-53h, CVS_IMWTH 54h-55h), clipped to the
+// active window (56h-5Dh). SetCanvas() points them at any 16bpp image in SDRAM, MAIN_IMAGE_START being the
+// one on the panel, so off-screen images can be drawn with the same routines and BTE copied in later.
+
+static uint32_t lt7680CanvasAddr = MAIN_IMAGE_START;   // SDRAM start of the current canvas
+static uint16_t lt7680CanvasWidth = LCD_XSIZE_TFT;     // Its image width in pixels
+static uint16_t lt7680CanvasHeight = LCD_YSIZE_TFT;    // and height, for the active window
+
+// Point the canvas and active window at a width x height 16bpp image at 'address' (4 byte aligned)
+// The engines must be idle, every drawing routine here ends with WaitForLT7680Ready()
+void SetCanvas(uint32_t address, uint16_t width, uint16_t height) {
+    const uint8_t regs[] = {
+        0x50, address & 0xFC,                   // CVSSA[7:0], bits 1-0 = 0
+        0x51, (address >> 8) & 0xFF,            // CVSSA[15:8]
+        0x52, (address >> 16) & 0xFF,           // CVSSA[23:16]
+        0x53, (address >> 24) & 0xFF,           // CVSSA[31:24]
+        0x54, width & 0xFF,                     // CVS_IMWTH[7:0]
+        0x55, (width >> 8) & 0x3F,              // CVS_IMWTH[13:8]
+        0x56, 0x00,                             // Active window X start low
+        0x57, 0x00,                             // Active window X start high
+        0x58, 0x00,                             // Active window Y start low
+        0x59, 0x00,                             // Active window Y start high
+        0x5A, width & 0xFF,                     // AW_WTH[7:0] - active window width, not end
+        0x5B, (width >> 8) & 0x1F,              // AW_WTH[12:8]
+        0x5C, height & 0xFF,                    // AW_HT[7:0] - height
+        0x5D, (height >> 8) & 0x1F,             // AW_HT[12:8]
+    };
+
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+
+    lt7680CanvasAddr = address;
+    lt7680CanvasWidth = width;
+    lt7680CanvasHeight = height;
+}
+
+
+// BTE destination = the current canvas, block origin x,y
+static void LT7680_BteDestination(uint16_t x, uint16_t y) {
+    const uint8_t regs[] = {
+        0xA7, lt7680CanvasAddr & 0xFF,          // DT_STR[7:0] - destination start address
+        0xA8, (lt7680CanvasAddr >> 8) & 0xFF,   // DT_STR[15:8]
+        0xA9, (lt7680CanvasAddr >> 16) & 0xFF,  // DT_STR[23:16]
+        0xAA, (lt7680CanvasAddr >> 24) & 0xFF,  // DT_STR[31:24]
+        0xAB, lt7680CanvasWidth & 0xFF,         // DT_WTH[7:0] - destination image width
+        0xAC, (lt7680CanvasWidth >> 8) & 0x1F,  // DT_WTH[12:8]
+        0xAD, x & 0xFF,                         // DT_X[7:0]
+        0xAE, (x >> 8) & 0x1F,                  // DT_X[12:8]
+        0xAF, y & 0xFF,                         // DT_Y[7:0]
+        0xB0, (y >> 8) & 0x1F,                  // DT_Y[12:8]
+    };
+
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+}
+
+
+// BTE block size, start and wait - STSR core busy covers the BTE as well as the geometry and text engines
+static void LT7680_BteRun(uint16_t w, uint16_t h) {
+    const uint8_t regs[] = {
+        0xB1, w & 0xFF,                         // BTE_WTH[7:0]
+        0xB2, (w >> 8) & 0x1F,                  // BTE_WTH[12:8]
+        0xB3, h & 0xFF,                         // BTE_HIG[7:0]
+        0xB4, (h >> 8) & 0x1F,                  // BTE_HIG[12:8]
+    };
+
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+    WriteDataToRegister(0x90, 0x10);            // BTE_CTRL0 - bit 4 starts the BTE
+
+    WaitForLT7680Ready();
+}
+
+
+// Filled rectangle using the LT7680 Block Transfer Engine solid fill, origin x,y, w x h pixels, colour 0xRRGGBB
+// The static setup is caught by the register shadow, repeat fills only send area, colour and start
+// Note: leaves the foreground colour (D2-D4) set to 'colour', text drawing must call SetTextColors() again
+void FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t colour) {
+
+    if (w == 0 || h == 0) return;
+
+    const uint8_t regs[] = {
+        0x91, 0x0C,                             // BTE_CTRL1 - ROP unused, operation 1100b = solid fill
+        0x92, 0x25,                             // BTE_COLR - S0/S1/destination all 16bpp
+        0xD2, (colour >> 16) & 0xFF,            // Foreground Color Red
+        0xD3, (colour >> 8) & 0xFF,             // Foreground Color Green
+        0xD4, colour & 0xFF,                    // Foreground Color Blue
+    };
+
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+    LT7680_BteDestination(x, y);
+    LT7680_BteRun(w, h);
+}
+
+
+// Copy a w x h block from a 16bpp image in SDRAM (srcAddr, srcWidth pixels wide) to the canvas at x,y
+// BTE memory copy with ROP = S0, a fixed handful of register writes whatever the block holds
+void CopyRect(uint32_t srcAddr, uint16_t srcWidth, uint16_t srcX, uint16_t srcY, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+
+    if (w == 0 || h == 0) return;
+
+    const uint8_t regs[] = {
+        0x91, 0xC2,                             // BTE_CTRL1 - ROP 1100b = S0, operation 0010b = memory copy with ROP
+        0x92, 0x25,                             // BTE_COLR - S0/S1/destination all 16bpp
+        0x93, srcAddr & 0xFF,                   // S0_STR[7:0] - source start address
+        0x94, (srcAddr >> 8) & 0xFF,            // S0_STR[15:8]
+        0x95, (srcAddr >> 16) & 0xFF,           // S0_STR[23:16]
+        0x96, (srcAddr >> 24) & 0xFF,           // S0_STR[31:24]
+        0x97, srcWidth & 0xFF,                  // S0_WTH[7:0] - source image width
+        0x98, (srcWidth >> 8) & 0x1F,           // S0_WTH[12:8]
+        0x99, srcX & 0xFF,                      // S0_X[7:0]
+        0x9A, (srcX >> 8) & 0x1F,               // S0_X[12:8]
+        0x9B, srcY & 0xFF,                      // S0_Y[7:0]
+        0x9C, (srcY >> 8) & 0x1F,               // S0_Y[12:8]
+    };
+
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+    LT7680_BteDestination(x, y);
+    LT7680_BteRun(w, h);
+}
+
+
+//**************************************************************************************************
+// Display pages
+//
+// With LT7680_DISPLAY_PAGES 2 the panel scans the front page (MISA 20h-23h) while everything is drawn into
+// the back page. LT7680_PageFlip() queues a clear of the INTF Vsync flag, a wait for it to be set again and
+// then the MISA switch, so MISA only changes at the start of a Vsync and the panel only ever shows finished
+// frames. The wait runs in the command queue (LT7680_WaitRegister()), the renderer does not block on it.
+// The pages then differ by what the last frame drew: callers report those rectangles with LT7680_PageDirty()
+// and LT7680_PageBegin() queues BTE copies of just them into the new back page, behind the MISA switch.
+
+#if LT7680_DISPLAY_PAGES > 1
+typedef struct {
+    uint16_t x, y, w, h;
+} LT7680_Rect;
+
+static uint8_t lt7680PageFront = 0;                     // Page MISA points at
+static uint8_t lt7680PageBack = 1;                      // Page the canvas points at
+static LT7680_Rect lt7680PageDirtyList[LT7680_PAGE_DIRTY_MAX];
+static uint8_t lt7680PageDirtyCount = 0;
+static uint8_t lt7680PageDirtyAll = 0;                  // List overflowed, copy the whole page
+static uint8_t lt7680PageForward = 0;                   // Flipped, back page still missing the dirty list
+
+volatile uint32_t lt7680PageFlips = 0;                  // Live Watch: MISA switches
+volatile uint32_t lt7680PageForwardRects = 0;           // Live Watch: BTE copies bringing the back page up to date
+
+#define LT7680_PAGE_ADDR(page)  (MAIN_IMAGE_START + (uint32_t)(page) * LT7680_PAGE_SIZE)
+#endif
+
+// Boot, after the visible image has been drawn: copy it to the other page and draw into that from now on
+void LT7680_PageInit(void) {
+#if LT7680_DISPLAY_PAGES > 1
+    WriteDataToRegister(0x0B, 0x10);            // INTEN - Vsync time base, sets INTF bit 4 (INT pin is not connected)
+
+    SetCanvas(LT7680_PAGE_ADDR(1), LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+    CopyRect(LT7680_PAGE_ADDR(0), LCD_XSIZE_TFT, 0, 0, 0, 0, LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+
+    lt7680PageFront = 0;
+    lt7680PageBack = 1;
+    lt7680PageDirtyCount = 0;
+    lt7680PageDirtyAll = 0;
+    lt7680PageForward = 0;
+#endif
+}
+
+// SDRAM address drawing goes to, for code that moves the canvas elsewhere and back
+uint32_t LT7680_PageBackAddr(void) {
+#if LT7680_DISPLAY_PAGES > 1
+    return LT7680_PAGE_ADDR(lt7680PageBack);
+#else
+    return MAIN_IMAGE_START;
+#endif
+}
+
+// Record a rectangle drawn into the back page, a run extending the previous one along Y is merged into it
+void LT7680_PageDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if LT7680_DISPLAY_PAGES > 1
+    if (lt7680PageDirtyAll) return;
+
+    if (lt7680PageDirtyCount) {
+        LT7680_Rect* last = &lt7680PageDirtyList[lt7680PageDirtyCount - 1];
+        if (last->x == x && last->w == w && last->y + last->h == y) {
+            last->h += h;
+            return;
+        }
+    }
+
+    if (lt7680PageDirtyCount >= LT7680_PAGE_DIRTY_MAX) {
+        lt7680PageDirtyAll = 1;
+        return;
+    }
+
+    lt7680PageDirtyList[lt7680PageDirtyCount++] = (LT7680_Rect){ x, y, w, h };
+#else
+    (void)x; (void)y; (void)w; (void)h;
+#endif
+}
+
+// Before drawing a frame: bring the back page up to date with the one on screen. Nothing waits here, the
+// copies are queued behind the Vsync wait and MISA switch of the last LT7680_PageFlip().
+void LT7680_PageBegin(void) {
+#if LT7680_DISPLAY_PAGES > 1
+    if (!lt7680PageForward) return;
+
+    uint32_t front = LT7680_PAGE_ADDR(lt7680PageFront);
+
+    if (lt7680PageDirtyAll) {
+        CopyRect(front, LCD_XSIZE_TFT, 0, 0, 0, 0, LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+        lt7680PageForwardRects++;
+    }
+    else {
+        for (uint8_t i = 0; i < lt7680PageDirtyCount; i++) {
+            const LT7680_Rect* r = &lt7680PageDirtyList[i];
+            CopyRect(front, LCD_XSIZE_TFT, r->x, r->y, r->x, r->y, r->w, r->h);
+        }
+        lt7680PageForwardRects += lt7680PageDirtyCount;
+    }
+
+    lt7680PageDirtyCount = 0;
+    lt7680PageDirtyAll = 0;
+    lt7680PageForward = 0;
+#endif
+}
+
+// After drawing a frame: show the back page from the next Vsync, nothing to do if the frame drew nothing
+void LT7680_PageFlip(void) {
+#if LT7680_DISPLAY_PAGES > 1
+    if (lt7680PageDirtyCount == 0 && !lt7680PageDirtyAll) return;
+
+    uint32_t addr = LT7680_PAGE_ADDR(lt7680PageBack);
+    const uint8_t misa[] = {
+        0x20, addr & 0xFC,                      // MISA[7:0], bits 1-0 = 0
+        0x21, (addr >> 8) & 0xFF,               // MISA[15:8]
+        0x22, (addr >> 16) & 0xFF,              // MISA[23:16]
+        0x23, (addr >> 24) & 0xFF,              // MISA[31:24]
+    };
+
+    // Queued behind the frame's engine waits: flag cleared first, so it is set again by the next Vsync, MISA after it
+    WriteDataToRegister(0x0C, 0x10);            // INTF - write 1 to clear the Vsync flag
+    LT7680_WaitRegister(0x0C, 0x10, 0x10);      // INTF bit 4 - Vsync time base
+    WriteRegisterBurst(misa, sizeof(misa) / 2);
+
+    lt7680PageFront = lt7680PageBack;
+    lt7680PageBack ^= 1;
+    SetCanvas(LT7680_PAGE_ADDR(lt7680PageBack), LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+
+    lt7680PageForward = 1;
+    lt7680PageFlips++;
+#endif
+}
+
+
+// PIP1 window over the main image: the x,y w x h region of a panel sized 16bpp image at 'address' is shown at
+// the same position on the panel, whatever page MISA points at. Draw into it with SetCanvas(address, ...).
+// x and w multiples of 4. Configure_Main_PIP_Window_LT() leaves both PIPs off with PIP1 at 16bpp.
+void LT7680_PipEnable(uint32_t address, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    const uint8_t window[] = {
+        0x10, 0x04,                             // MPWCTR - PIPs off, 2Ah-3Bh select PIP1, main image 16bpp
+        0x2A, x & 0xFC,                         // PWDULX[7:0] - window position on the panel
+        0x2B, (x >> 8) & 0x1F,                  // PWDULX[12:8]
+        0x2C, y & 0xFF,                         // PWDULY[7:0]
+        0x2D, (y >> 8) & 0x1F,                  // PWDULY[12:8]
+        0x2E, address & 0xFC,                   // PISA[7:0] - PIP image start address
+        0x2F, (address >> 8) & 0xFF,            // PISA[15:8]
+        0x30, (address >> 16) & 0xFF,           // PISA[23:16]
+        0x31, (address >> 24) & 0xFF,           // PISA[31:24]
+        0x32, LCD_XSIZE_TFT & 0xFC,             // PIW[7:0] - PIP image width
+        0x33, (LCD_XSIZE_TFT >> 8) & 0x1F,      // PIW[12:8]
+    };
+    const uint8_t image[] = {
+        0x34, x & 0xFC,                         // PWIULX[7:0] - window position in the PIP image, same as on the panel
+        0x35, (x >> 8) & 0x1F,                  // PWIULX[12:8]
+        0x36, y & 0xFF,                         // PWIULY[7:0]
+        0x37, (y >> 8) & 0x1F,                  // PWIULY[12:8]
+        0x38, w & 0xFC,                         // PWW[7:0] - window width
+        0x39, (w >> 8) & 0x1F,                  // PWW[12:8]
+        0x3A, h & 0xFF,                         // PWH[7:0] - window height
+        0x3B, (h >> 8) & 0x1F,                  // PWH[12:8]
+        0x11, 0x05,                             // PIPCDEP - PIP1 and PIP2 16bpp
+        0x10, 0x84,                             // MPWCTR - PIP1 on
+    };
+
+    WriteRegisterBurst(window, sizeof(window) / 2);
+    WriteRegisterBurst(image, sizeof(image) / 2);
+}
+
+
+//**************************************************************************************************
+// User-defined font (CGRAM)
+//
+// With CCR0 font source 10b the text engine takes glyphs from SDRAM at the CGRAM start address (DBh-DEh),
+// character code x glyph bytes in, 1bpp rows MSB first (16x32: 2 bytes x 32 rows). They are written once
+// through the memory data port with linear addressing. With the command queue built in the upload goes out
+// on SPI1 TX DMA even at boot, the CPU only fills the ring, and each chunk is one CS transaction under every
+// LT7680_SPI_TRANSPORT. Glyphs are in the same engine as CGROM ones, so per-character cost is unchanged.
+
+volatile uint32_t lt7680UserFontUploadUs = 0;           // Live Watch: wall time of the last LT7680_UserFontUpload()
+volatile LT7680_RenderProfile lt7680ProfUserFont;       // Live Watch: its SPI bytes, CS transactions and bus time
+
+// Memory data port write, same FIFO handling as DrawText()
+static void LT7680_MemoryWrite(const uint8_t* data, uint16_t len)
+{
+    WriteRegister(0x04);                    // MRWDP - memory data port, status reads leave it selected
+
+    while (len) {
+        uint8_t n = (len > LT7680_TEXT_CHUNK) ? LT7680_TEXT_CHUNK : (uint8_t)len;
+
+        LT7680_WaitStatus(LT7680_STSR_WR_FIFO_EMPTY, LT7680_STSR_WR_FIFO_EMPTY);
+
+        // One CS transaction per chunk whatever LT7680_SPI_TRANSPORT is, the port takes a continuous stream
+        uint8_t buf[1 + LT7680_TEXT_CHUNK];
+        buf[0] = 0x80;                      // A0 = 1, RW = 0, then continuous data
+        memcpy(&buf[1], data, n);
+        LT7680_Send(buf, 1 + n);
+
+        data += n;
+        len -= n;
+    }
+}
+
+// Upload 'glyphs' (glyphBytes each) for the character codes in 'codes' to the CGRAM at LT7680_CGRAM_ADDR
+// Leaves graphic position, memory mode and text mode as SendAllToLT7680_LT() set them
+void LT7680_UserFontUpload(const char* codes, const uint8_t* glyphs, uint8_t glyphBytes) {
+    LT7680_PROFILE_BEGIN();
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    uint32_t t0 = DWT->CYCCNT;
+
+#if LT7680_ASYNC_QUEUE
+    uint8_t queued = lt7680QueueEnabled;
+    lt7680QueueEnabled = 1;                 // DMA even during boot, fenced below
+#endif
+
+    const uint8_t regs[] = {
+        0xDB, LT7680_CGRAM_ADDR & 0xFF,         // CGRAM_STR[7:0]
+        0xDC, (LT7680_CGRAM_ADDR >> 8) & 0xFF,  // CGRAM_STR[15:8]
+        0xDD, (LT7680_CGRAM_ADDR >> 16) & 0xFF, // CGRAM_STR[23:16]
+        0xDE, (LT7680_CGRAM_ADDR >> 24) & 0xFF, // CGRAM_STR[31:24]
+        0x03, 0x00,                             // ICR - graphic mode, memory port to the SDRAM image buffer
+        0x5E, 0x04,                             // AW_COLOR - linear addressing, 8bpp so bytes land as written
+    };
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+
+    for (; *codes != '\0'; codes++, glyphs += glyphBytes) {
+        uint32_t addr = LT7680_CGRAM_ADDR + (uint32_t)(uint8_t)*codes * glyphBytes;
+
+        WriteDataToRegister(0x5F, addr & 0xFF);         // Linear address [7:0]
+        WriteDataToRegister(0x60, (addr >> 8) & 0xFF);  // [15:8]
+        WriteDataToRegister(0x61, (addr >> 16) & 0xFF); // [23:16]
+        WriteDataToRegister(0x62, (addr >> 24) & 0xFF); // [31:24]
+
+        LT7680_MemoryWrite(glyphs, glyphBytes);
+    }
+
+    WaitForLT7680Ready();
+    SetColorDepth_LT();                     // Block mode, 16bpp
+    ResetGraphicWritePosition_LT();
+    SetGraphicRWYCoordinate_LT();
+    Text_Mode();
+
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueFence();
+    lt7680QueueEnabled = queued;
+#endif
+
+    lt7680UserFontUploadUs = (DWT->CYCCNT - t0) / (SystemCoreClock / 1000000u);
+    LT7680_PROFILE_END(lt7680ProfUserFont);
+}
+
+
+//**************************************************************************************************
+// Pixel streaming (graphics mode, SPI1 TX DMA)
+//
+// Writes a w x h block of 16bpp pixels to the canvas through the memory data port: the active window is set to
+// the block, graphic mode auto-increments along X and wraps to the next line inside the window, so the pixels
+// just follow each other. CS stays low from LT7680_StreamBegin() to LT7680_StreamEnd() and the caller hands the
+// data over in chunks, each one a HAL_SPI_Transmit_DMA(). LT7680_StreamChunk() only waits for the previous chunk,
+// so with two buffers the CPU fills the next one while the DMA sends this one. The command queue is drained
+// first and stays empty, LT7680_QueueTxComplete() ignores the completions as nothing of its own is in flight.
+// Pixels are RGB565 little endian, the order the LT7680 takes 16bpp over an 8-bit port (low byte first).
+
+volatile uint32_t lt7680StreamBlocks = 0;               // Live Watch: LT7680_StreamBegin() calls
+volatile uint32_t lt7680StreamChunks = 0;               // Live Watch: DMA transfers started by LT7680_StreamChunk()
+volatile uint32_t lt7680StreamBlockUs = 0;              // Live Watch: wall time of the last block, Begin to End
+volatile uint32_t lt7680StreamWaitUs = 0;               // Live Watch: of which the CPU spent waiting for the DMA
+
+static uint32_t lt7680StreamT0, lt7680StreamWait;
+
+static void LT7680_StreamWaitDma(void) {
+    uint32_t t = DWT->CYCCNT;
+    while (HAL_SPI_GetState(&hspi1) != HAL_SPI_STATE_READY);
+    lt7680StreamWait += DWT->CYCCNT - t;
+}
+
+// Open a w x h block at x,y on the canvas, graphic mode, CS low and memory write started
+// The engines must be idle (every drawing routine here ends with WaitForLT7680Ready())
+void LT7680_StreamBegin(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    lt7680StreamT0 = DWT->CYCCNT;
+    lt7680StreamWait = 0;
+
+    const uint8_t regs[] = {
+        0x03, 0x00,                             // ICR - graphic mode, memory port to the SDRAM image buffer
+        0x56, x & 0xFF,                         // AW_HSA[7:0] - active window = the block
+        0x57, (x >> 8) & 0x1F,                  // AW_HSA[12:8]
+        0x58, y & 0xFF,                         // AW_VSA[7:0]
+        0x59, (y >> 8) & 0x1F,                  // AW_VSA[12:8]
+        0x5A, w & 0xFF,                         // AW_WTH[7:0] - width, not end
+        0x5B, (w >> 8) & 0x1F,                  // AW_WTH[12:8]
+        0x5C, h & 0xFF,                         // AW_HT[7:0] - height
+        0x5D, (h >> 8) & 0x1F,                  // AW_HT[12:8]
+        0x5F, x & 0xFF,                         // CURH[7:0] - graphic write position, block origin
+        0x60, (x >> 8) & 0x1F,                  // CURH[12:8]
+        0x61, y & 0xFF,                         // CURV[7:0]
+        0x62, (y >> 8) & 0x1F,                  // CURV[12:8]
+    };
+    WriteRegisterBurst(regs, sizeof(regs) / 2);
+    LT7680_WaitStatus(LT7680_STSR_WR_FIFO_EMPTY, LT7680_STSR_WR_FIFO_EMPTY);
+    WriteRegister(0x04);                        // MRWDP - memory data port
+
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueFence();                        // SPI1 and its DMA to ourselves until LT7680_StreamEnd()
+#endif
+
+    uint8_t control = 0x80;                     // A0 = 1, RW = 0, then continuous data
+    LT7680_CS_LOW();
+    HAL_SPI_Transmit(&hspi1, &control, 1, HAL_MAX_DELAY);
+
+    lt7680SpiBytes += 1;
+    lt7680SpiXfers++;
+    lt7680StreamBlocks++;
+}
+
+// Send 'len' bytes of pixels, returns as soon as the DMA has them
+// 'data' must not change until the next LT7680_StreamChunk() or LT7680_StreamEnd() returns
+void LT7680_StreamChunk(const uint8_t* data, uint16_t len) {
+    LT7680_StreamWaitDma();                     // Previous chunk out
+    HAL_SPI_Transmit_DMA(&hspi1, (uint8_t*)data, len);
+
+    lt7680SpiBytes += len;
+    lt7680StreamChunks++;
+}
+
+// Wait for the last chunk, CS high, active window back to the whole canvas and text mode
+void LT7680_StreamEnd(void) {
+    LT7680_StreamWaitDma();
+    LT7680_CS_HIGH();
+
+    SetCanvas(lt7680CanvasAddr, lt7680CanvasWidth, lt7680CanvasHeight);
+    Text_Mode();
+
+    lt7680StreamBlockUs = (DWT->CYCCNT - lt7680StreamT0) / (SystemCoreClock / 1000000u);
+    lt7680StreamWaitUs = lt7680StreamWait / (SystemCoreClock / 1000000u);
+}
+
+
 void TFT_WipeTest(void)
 {
     // Forward wipe: top -> bottom
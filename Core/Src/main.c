@@ -20,7 +20,7 @@
   * 9           B15               INA
   * 15          B14               ISA
   * 12          B11               SYNC
-  * 6           B1                02
+  * 6           B1                02 (also link B1 to B13 for DMM_CAPTURE_SPI2)
   * 2           B12               PW0
   * 5           not connected
   * 20                            +5V
@@ -45,6 +45,7 @@
 #include <stdbool.h>    // bool support, otherwise use _Bool
 #include <stdlib.h>
 #include "display.h"
+#include "lcd.h"
 #include "stm32f1xx_hal.h"
 #include "stm32f1xx_hal_tim.h"
 #include <stddef.h>
@@ -103,6 +104,9 @@ volatile uint32_t dbg_loop_per_sec = 0;
 volatile uint32_t dbg_loop_last_ms = 0;
 volatile uint32_t dbg_loop_test_done = 0;
 
+// Main loop
+volatile MainLoopStats mainLoopStats;		// Live Watch: frames/sec and idle %
+
 
 //******************************************************************************
 
@@ -114,6 +118,8 @@ volatile uint8_t Init_Completed_flag = 0;
 
 // Private function prototypes
 void SystemClock_Config(void);
+void RunBluePillSpeedTestOffline(void);
+void RunBluePillSpeedTestOnline(void);
 
 //******************************************************************************
 
@@ -122,6 +128,9 @@ void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi) {
 	if (hspi->Instance == SPI1)
 	{
 		SPI1_TX_completed_flag = 1;
+#if LT7680_ASYNC_QUEUE
+		LT7680_QueueTxComplete();	// CS high, start the next queued LT7680 transaction
+#endif
 	}
 }
 
@@ -145,8 +154,7 @@ int main(void) {
 
 	MX_TIM3_Init();
 
-	// Start TIM3 input-capture on CH4 (PB1 = TIM3_CH4)
-	HAL_TIM_IC_Start_IT(&htim3, TIM_CHANNEL_4);
+	DMM_CaptureStart();		// 3457A capture engine, see DMM_CAPTURE_ENGINE in main.h
 
 	// Pull CS high and SCLK low immediately after reset
 	HAL_GPIO_WritePin(LCD_CS_Port, LCD_CS_Pin, GPIO_PIN_SET);			// Pull CS high
@@ -165,6 +173,12 @@ int main(void) {
 
 	SendAllToLT7680_LT();			// run subs to setup LT7680 based on Levetop info
 
+	LT7680_SpiAutoTune();			// Fastest reliable SPI1 clock now the LT7680 PLL is running, see lt7680SpiTune
+
+#if LT7680_SPI_BENCH
+	LT7680_SpiBenchmark();			// HAL vs LL bytes/sec and transactions/sec, see lt7680SpiBench
+#endif
+
 	HAL_Delay(10);
 
 	// Main loop timer
@@ -213,7 +227,32 @@ int main(void) {
 	RunBluePillSpeedTestOffline();	// BluePill speed test = 1634249 approx is good
 	ClearScreen();					// Again.....
 
-	while (1) {			// While loop running continious, full speed
+	LoadMainFont();					// MAIN user-defined font into the LT7680 CGRAM, over SPI1 DMA
+#if MAIN_GLYPH_ATLAS
+	BuildMainGlyphAtlas();			// Off-screen MAIN glyphs, blocking here rather than as one long first frame through the queue
+#endif
+	LT7680_PageInit();				// Second display page, all drawing goes there from now on and is flipped in
+	InitAnnunciatorLayer();			// Annunciator strip on its own PIP1 layer
+
+#if LT7680_ASYNC_QUEUE
+	LT7680_QueueEnable(1);			// From here LT7680 writes are queued and sent by DMA, boot setup above stays blocking
+#endif
+
+	// DWT cycle counter for the idle % measurement
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	HAL_DBGMCU_EnableDBGSleepMode();	// Keep the debugger and Live Watch alive during WFI
+
+	uint32_t renderedGen = 0xFFFFFFFF;	// Frame generation last sent to the LT7680, first pass always draws
+	uint32_t lastRenderMs = HAL_GetTick() - DISPLAY_MIN_FRAME_MS;
+	uint32_t lastServiceMs = HAL_GetTick();
+	uint32_t statsStartMs = HAL_GetTick();
+	uint32_t statsStartCycles = DWT->CYCCNT;
+	uint32_t idleCycles = 0;
+	uint32_t frames = 0;
+	uint32_t wakeups = 0;
+
+	while (1) {			// Event loop, sleeps until a new frame is published or SysTick housekeeping
 
 		// TEST
 		//isaState = HAL_GPIO_ReadPin(DMM_ISA_GPIO_Port, DMM_ISA_Pin);
@@ -221,15 +260,54 @@ int main(void) {
 		//volatile uint8_t debugIsaState = isaState; // Monitor these in Live Watch
 		//volatile uint8_t debugInaState = inaState;
 
-		HAL_GPIO_TogglePin(GPIOC, TEST_OUT_Pin); // Test LED toggle
+		uint32_t now = HAL_GetTick();
+		wakeups++;
+
+		if ((now - lastServiceMs) >= DISPLAY_HOUSEKEEPING_MS) {
+			lastServiceMs = now;
+			DMM_CaptureService();	// Flush any captured 3457A words not yet decoded
+		}
+
+		// Render at most once per new frame, and no faster than DISPLAY_MAX_FPS
+		if (DMM_FrameGeneration() != renderedGen && (now - lastRenderMs) >= DISPLAY_MIN_FRAME_MS) {
+			renderedGen = DMM_FrameGeneration();
+			lastRenderMs = now;
+
+			HAL_GPIO_TogglePin(GPIOC, TEST_OUT_Pin); // Test LED toggle, once per rendered frame
 
-		DisplayMain();
+			LT7680_PageBegin();		// Back page catches up with the one on screen
 
-		//HAL_Delay(10);
+			DisplayMain();
 
-		DisplayAnnunciators();
+			DisplayAnnunciators();
 
-		//HAL_Delay(10);
+			LT7680_PageFlip();		// Show the finished frame from the next Vsync
+
+			frames++;
+			mainLoopStats.framesRendered++;
+		}
+
+		if ((now - statsStartMs) >= 1000) {
+			uint32_t elapsed = DWT->CYCCNT - statsStartCycles;
+			mainLoopStats.framesPerSec = frames;
+			mainLoopStats.wakeupsPerSec = wakeups;
+			mainLoopStats.idlePercent = (elapsed >= 100) ? idleCycles / (elapsed / 100) : 0;
+			statsStartMs = now;
+			statsStartCycles += elapsed;
+			idleCycles = 0;
+			frames = 0;
+			wakeups = 0;
+		}
+
+		// Sleep with interrupts masked so a frame published between the check and WFI still wakes us.
+		// SysTick (1ms) bounds the wait, PendSV/capture IRQs publishing a frame wake us earlier.
+		__disable_irq();
+		if (DMM_FrameGeneration() == renderedGen || (HAL_GetTick() - lastRenderMs) < DISPLAY_MIN_FRAME_MS) {
+			uint32_t sleep0 = DWT->CYCCNT;
+			__WFI();
+			idleCycles += DWT->CYCCNT - sleep0;
+		}
+		__enable_irq();
 	}
 
 }
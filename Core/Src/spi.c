@@ -8,10 +8,13 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "spi.h"
+#include "lt7680.h"
 
 /* SPI Handles */
 SPI_HandleTypeDef hspi1;
+SPI_HandleTypeDef hspi2;
 DMA_HandleTypeDef hdma_spi1_tx;
+DMA_HandleTypeDef hdma_spi2_rx;
 
 
 // SPI1 init function
@@ -20,11 +23,15 @@ void MX_SPI1_Init(void)                                     // LCD (LT7680)
     hspi1.Instance = SPI1;
     hspi1.Init.Mode = SPI_MODE_MASTER;
     hspi1.Init.Direction = SPI_DIRECTION_2LINES;            // Full-duplex for 4-wire SPI
+#if LT7680_LL_FRAME16
+    hspi1.Init.DataSize = SPI_DATASIZE_16BIT;               // Control + payload per frame, LL driver only
+#else
     hspi1.Init.DataSize = SPI_DATASIZE_8BIT;                // 8-bit data frame
+#endif
     hspi1.Init.CLKPolarity = SPI_POLARITY_HIGH;             // Clock idle high according to LT7680 timing diagram
     hspi1.Init.CLKPhase = SPI_PHASE_2EDGE;                  // Data captured on 2nd edge according to LT7680 timing diagram (CPOL=1)
     hspi1.Init.NSS = SPI_NSS_SOFT;                          // Software-controlled CS
-    hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8; // Prescaler for SPI speed default = 8 which is 9Mhz, well below LT7680 max of 50Mhz SPI CLK
+    hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8; // Prescaler for SPI speed default = 8 which is 9Mhz, well below LT7680 max of 50Mhz SPI CLK. Raised by LT7680_SpiAutoTune() after LT7680 setup
     hspi1.Init.FirstBit = SPI_FIRSTBIT_MSB;                 // Most significant bit first
     hspi1.Init.TIMode = SPI_TIMODE_DISABLE;                 // No TI mode
     hspi1.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE; // No CRC calculation
@@ -36,6 +43,28 @@ void MX_SPI1_Init(void)                                     // LCD (LT7680)
 }
 
 
+// SPI2 init function
+void MX_SPI2_Init(void)                                     // 3457A ISA/INA capture (O2 = SCK)
+{
+    hspi2.Instance = SPI2;
+    hspi2.Init.Mode = SPI_MODE_SLAVE;                       // O2 from the 3457A is the bit clock
+    hspi2.Init.Direction = SPI_DIRECTION_2LINES_RXONLY;     // INA on MOSI, MISO is never driven (ISA selected via BIDIMODE at SYNC edges)
+    hspi2.Init.DataSize = SPI_DATASIZE_8BIT;
+    hspi2.Init.CLKPolarity = SPI_POLARITY_LOW;              // Sample on O2 rising edge, same as the TIM3 capture
+    hspi2.Init.CLKPhase = SPI_PHASE_1EDGE;
+    hspi2.Init.NSS = SPI_NSS_SOFT;                          // No chip select, framing comes from SYNC
+    hspi2.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2; // Not used in slave mode
+    hspi2.Init.FirstBit = SPI_FIRSTBIT_LSB;                 // 3457A sends LSB first
+    hspi2.Init.TIMode = SPI_TIMODE_DISABLE;
+    hspi2.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    hspi2.Init.CRCPolynomial = 10;
+    if (HAL_SPI_Init(&hspi2) != HAL_OK)
+    {
+        Error_Handler();
+    }
+}
+
+
 /*
 void MX_SPI1_Init(void) {
     __HAL_RCC_SPI1_CLK_ENABLE();  // Enable SPI1 clock
@@ -107,6 +136,41 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef* spiHandle)
 
         __HAL_LINKDMA(spiHandle, hdmatx, hdma_spi1_tx);
     }
+    else if (spiHandle->Instance == SPI2)                      // 3457A capture
+    {
+        /* SPI2 clock enable */
+        __HAL_RCC_SPI2_CLK_ENABLE();
+
+        /* Enable GPIOB clock */
+        __HAL_RCC_GPIOB_CLK_ENABLE();
+
+        /** SPI2 GPIO Configuration
+        PB13 ------> SPI2_SCK  (O2, linked from PB1)
+        PB14 ------> SPI2_MISO (ISA, input while BIDIOE = 0)
+        PB15 ------> SPI2_MOSI (INA)
+        All inputs - the 3457A lines must never be driven
+        */
+        GPIO_InitStruct.Pin = DMM_O2_SPI_Pin | DMM_ISA_Pin | DMM_INA_Pin;
+        GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+        GPIO_InitStruct.Pull = GPIO_NOPULL;
+        HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+        /* SPI2 DMA Init */
+        hdma_spi2_rx.Instance = DMA1_Channel4;
+        hdma_spi2_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+        hdma_spi2_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+        hdma_spi2_rx.Init.MemInc = DMA_MINC_ENABLE;
+        hdma_spi2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma_spi2_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        hdma_spi2_rx.Init.Mode = DMA_CIRCULAR;              // Free-running ring, decoder chases the write index
+        hdma_spi2_rx.Init.Priority = DMA_PRIORITY_HIGH;
+        if (HAL_DMA_Init(&hdma_spi2_rx) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        __HAL_LINKDMA(spiHandle, hdmarx, hdma_spi2_rx);
+    }
 
 }
 
@@ -129,6 +193,14 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* spiHandle)
         /* SPI1 DMA DeInit */
         HAL_DMA_DeInit(spiHandle->hdmatx);
     }
+    else if (spiHandle->Instance == SPI2)                       // 3457A capture
+    {
+        /* SPI2 clock disable */
+        __HAL_RCC_SPI2_CLK_DISABLE();
+
+        /* SPI2 DMA DeInit (pins stay plain inputs) */
+        HAL_DMA_DeInit(spiHandle->hdmarx);
+    }
 
 }
 
@@ -22,6 +22,8 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "timer.h"
+#include "lt7680.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,7 +59,7 @@ extern uint8_t Init_Completed_flag;
 
 /* External variables --------------------------------------------------------*/
 extern DMA_HandleTypeDef hdma_spi1_tx;
-//extern DMA_HandleTypeDef hdma_spi2_rx;
+extern DMA_HandleTypeDef hdma_spi2_rx;
 //extern SPI_HandleTypeDef hspi2;
 /* USER CODE BEGIN EV */
 
@@ -173,7 +175,9 @@ void DebugMon_Handler(void)
 void PendSV_Handler(void)
 {
     /* USER CODE BEGIN PendSV_IRQn 0 */
-
+#if DMM_DEFERRED_BUILD
+    DMM_FrameBuild();       // pended by the 3457A decoder when a register frame completes
+#endif
     /* USER CODE END PendSV_IRQn 0 */
     /* USER CODE BEGIN PendSV_IRQn 1 */
 
@@ -190,6 +194,9 @@ void SysTick_Handler(void)
     /* USER CODE END SysTick_IRQn 0 */
     HAL_IncTick();
     /* USER CODE BEGIN SysTick_IRQn 1 */
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueTick();                     // Retries a status wait the queue parked on
+#endif
 
     /* USER CODE END SysTick_IRQn 1 */
 }
@@ -201,6 +208,23 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f1xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles DMA1 channel2 global interrupt.
+  */
+void DMA1_Channel2_IRQHandler(void)
+{
+    /* USER CODE BEGIN DMA1_Channel2_IRQn 0 */
+
+    /* USER CODE END DMA1_Channel2_IRQn 0 */
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+    HAL_DMA_IRQHandler(&hdma_tim3_ch3);
+    /* USER CODE BEGIN DMA1_Channel2_IRQn 1 */
+    // Also entered by software pend from DMM_CaptureService(), so drain unconditionally
+    DMM_DmaDrain();
+    /* USER CODE END DMA1_Channel2_IRQn 1 */
+#endif
+}
+
 /**
   * @brief This function handles DMA1 channel3 global interrupt.
   */
@@ -211,6 +235,9 @@ void DMA1_Channel3_IRQHandler(void)
     /* USER CODE END DMA1_Channel3_IRQn 0 */
     HAL_DMA_IRQHandler(&hdma_spi1_tx);
     /* USER CODE BEGIN DMA1_Channel3_IRQn 1 */
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueService();                  // Pended by LT7680_QueueKick() when the queue was idle
+#endif
 
     /* USER CODE END DMA1_Channel3_IRQn 1 */
 }
@@ -223,10 +250,13 @@ void DMA1_Channel4_IRQHandler(void)
     /* USER CODE BEGIN DMA1_Channel4_IRQn 0 */
 
     /* USER CODE END DMA1_Channel4_IRQn 0 */
-    //HAL_DMA_IRQHandler(&hdma_spi2_rx);                  // not used on 3457A
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+    HAL_DMA_IRQHandler(&hdma_spi2_rx);
     /* USER CODE BEGIN DMA1_Channel4_IRQn 1 */
-
+    // Also entered by software pend from the SYNC EXTI, so drain unconditionally
+    DMM_Spi2Drain();
     /* USER CODE END DMA1_Channel4_IRQn 1 */
+#endif
 }
 
 /**
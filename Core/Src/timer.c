@@ -10,6 +10,7 @@
 #include "stm32f1xx_hal.h"
 #include "stm32f1xx_hal_tim.h"
 #include "main.h"  // Include main.h to access DMM pin definitions
+#include "spi.h"   // SPI2 capture engine
 
 //***********************************************************************************
 // Timer 2 - Timed Action loop
@@ -64,35 +65,12 @@ void SetTimerDuration(uint16_t ms) {
 //***********************************************************************************
 // Timer 3 - 3457A Input Capture Functionality
 
-/* Buffers for Data Capture */
-#define MAX_BUFFER_SIZE 256
-
-volatile uint8_t isaBuffer[MAX_BUFFER_SIZE];
-volatile uint8_t inaBuffer[MAX_BUFFER_SIZE];
-static uint16_t isaIndex = 0;
-static uint16_t inaIndex = 0;
-#define LOG_TRIGGER_COUNT 256 // Log after 256 samples
-
-/* Private Function Prototypes */
-volatile uint8_t bufferFull = 0; // Indicates if the buffer is full
 volatile uint8_t syncState = 0;
-volatile uint32_t O2Count;
-volatile uint32_t ISAcount = 0;
-volatile uint32_t INAcount = 0;
-volatile uint8_t  lastBit = 0;
-volatile uint8_t  lastSync = 0;
-volatile uint32_t lastBitOnes = 0;
-volatile uint32_t syncHighCount = 0;
-volatile uint32_t syncLowCount = 0;
-
-// *********************************************
 
 // ---- Decode state (Live Watch friendly) ----
 volatile uint16_t lastCmd = 0;
-volatile uint8_t  lastDataByte = 0;
 volatile uint8_t  payloadBytesExpected = 0;
 volatile uint8_t  payloadBytesGot = 0;
-volatile uint8_t  frameReady = 0;
 
 volatile uint8_t  regA[6], regB[6], regC[6];
 volatile uint8_t  ann[2];
@@ -100,20 +78,131 @@ volatile uint8_t  ann[2];
 // Internal decode state
 static uint8_t  prevSync = 0;
 
-static uint8_t currentTarget = 0;  // 1=A,2=B,3=C,4=ANN,5=X(2E0)
+// ISA command targets (payload handlers) and statistics slots, see dmmCmdTable
+#define CMD_TGT_NONE        0
+#define CMD_TGT_REGA        1
+#define CMD_TGT_REGB        2
+#define CMD_TGT_REGC        3
+#define CMD_TGT_ANN         4
+#define CMD_TGT_COUNT       5
+
+#define CMD_STAT_OTHER      0       // not one of the known opcodes
+#define CMD_STAT_028        1
+#define CMD_STAT_068        2       // 0x068
+#define CMD_STAT_0A8        3       // 0x0A8
+#define CMD_STAT_2F0        4
+#define CMD_STAT_2E0        5
+#define CMD_STAT_3F0        6
+#define CMD_STAT_320        7
+#define CMD_STAT_NEAR060    8       // 0x060..0x067
+#define CMD_STAT_NEAR0A0    9       // 0x0A0..0x0A7
+#define CMD_STAT_068_OTHER  10      // 0x069..0x06F
+#define CMD_STAT_0A8_OTHER  11      // 0x0A9..0x0AF
+#define CMD_STAT_COUNT      12
+
+static uint8_t currentTarget = 0;  // CMD_TGT_*
+static uint8_t byteShift = 0;      // assembled 8-bit value, LSB-first
+static uint8_t byteBitCount = 0;   // 0..7
+static uint16_t isa10 = 0;
+static uint8_t  isaBitCount = 0;
+static uint8_t  inaGap2 = 0;      // counts down 2->0 after SYNC falls
 
-// Decoded output for Live Watch / display
-volatile uint8_t digitCode[12];   // 7-bit HP char code per digit (1..12 -> index 0..11)
-volatile uint8_t punctCode[12];   // 0..3 (none, '.', ':', ',')
+// Decoded output for the display
+volatile char displayStr[13];       // 12 chars + \0
+volatile char punctStr[13];         // punctuation per digit + \0
+volatile char displayWithPunct[32]; // debug/combined string + \0
+volatile uint8_t Annunc[13];   // use indices 1..12, ignore 0
+static uint8_t frameCode[12];       // 7-bit HP char code per digit, left to right (d = 1..12)
+static uint8_t framePunct[12];      // 0..3 (none, '.', ':', ',')
+static void HP3457_DecodeFrame(const uint8_t a[6], const uint8_t b[6], const uint8_t c[6],
+                               uint8_t code12[12], uint8_t punct12[12]);
+DMM_RAMFUNC static void DMM_ProcessCommand(uint16_t cmd);
+DMM_RAMFUNC static void DMM_ProcessDataByte(uint8_t dataByte);
+DMM_RAMFUNC static void DMM_LatchFrame(void);
+
+// Deferred display string building (PendSV)
+static volatile uint8_t regALatched[6], regBLatched[6], regCLatched[6];    // written by the capture ISR
+static volatile uint32_t frameLatchSeq = 0;
+static volatile uint8_t annLatched[2];
+static volatile uint32_t frameLatchTick = 0;
+static uint8_t regAFrame[6], regBFrame[6], regCFrame[6];                    // DMM_FrameBuild() working copy
+static volatile DMM_Frame dmmFrame;                                         // published frame, see DMM_FrameSnapshot()
+static volatile uint32_t dmmFrameLock = 0;
+static void DMM_FramePublish(uint32_t seq, uint32_t tick);
+void HP3457_BuildDisplayString(char out12[13], char punct12[13]);
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+static void DMM_DmaCaptureStart(void);
+#endif
 
-static void DecodeAllDigits(void);
 
-volatile uint8_t lastExpected = 0;
+//***********************************************************************************
+// Decoder instrumentation - only what DMM_INSTRUMENT (timer.h) asks for is compiled in
+
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+volatile uint32_t O2Count;
+volatile uint32_t ISAcount = 0;
+volatile uint32_t INAcount = 0;
+volatile uint32_t lastBitOnes = 0;
+volatile uint32_t syncHighCount = 0;
+volatile uint32_t syncLowCount = 0;
+volatile uint32_t isaBranchHits = 0;
 volatile uint32_t cmd028Count = 0;
-volatile uint32_t cmd068Count = 0;
-volatile uint32_t cmd0A8Count = 0;
+volatile uint32_t cmd068Count = 0;      // 0x068..0x06F
+volatile uint32_t cmd0A8Count = 0;      // 0x0A8..0x0AF
 volatile uint32_t cmd2F0Count = 0;
+volatile uint32_t cmd2E0Count = 0;  // Live Watch
+volatile uint32_t cmd3F0Count = 0;
+volatile uint32_t cmd320Count = 0;
+volatile uint32_t cmdOtherCount = 0;   // everything but 0x028, 0x068, 0x0A8, 0x2F0, 0x2E0, 0x3F0 and 0x320
+volatile uint32_t cmd068NearCount = 0;   // counts commands in 0x060..0x06F
+volatile uint32_t cmd0A8NearCount = 0;   // counts commands in 0x0A0..0x0AF
+volatile uint32_t cmdIgnoredCount = 0;
+volatile uint32_t regCWrites = 0;
+volatile uint32_t regCNonZeroWrites = 0;
+volatile uint32_t frameSnapshotRetries = 0;   // Live Watch - reader raced the writer
+volatile uint32_t frameUnchangedCount = 0;    // Live Watch - repeated frames dropped at the latch
+volatile uint32_t o2IsrCycles = 0;            // Live Watch - TIM3 IRQ duration, CPU cycles (72 per us)
+volatile uint32_t o2IsrCyclesMax = 0;         // Live Watch - worst case since reset
+volatile uint32_t o2IsrOverBudget = 0;        // Live Watch - edges over DMM_O2_CYCLE_BUDGET
+volatile uint32_t frameBuildCycles = 0;       // Live Watch - DMM_FrameBuild() duration
+volatile uint32_t frameBuildCyclesMax = 0;
+#endif
+
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
+/* Buffers for Data Capture */
+#define MAX_BUFFER_SIZE 256
+
+volatile uint8_t isaBuffer[MAX_BUFFER_SIZE];
+volatile uint8_t inaBuffer[MAX_BUFFER_SIZE];
+static uint16_t isaIndex = 0;
+static uint16_t inaIndex = 0;
+volatile uint8_t  lastBit = 0;
+volatile uint8_t  lastSync = 0;
+volatile uint8_t  lastDataByte = 0;
+volatile uint8_t  frameReady = 0;
+volatile uint8_t lastExpected = 0;
 volatile uint16_t lastCmd2 = 0;
+volatile uint16_t lastCmd10 = 0;
+volatile uint16_t cmdRing[16];
+volatile uint8_t  cmdRingIdx = 0;
+volatile uint8_t  lastRegC[6];
+volatile uint16_t lastCmdAtRegC = 0;
+volatile uint8_t dbgCode[12];
+volatile uint8_t dbgCode_alt[12];
+volatile uint32_t decodeMismatchCount = 0;  // HP3457_DecodeFrame() disagreed with the per-digit reference decode
+static uint8_t HP3457_GetCharCode(uint8_t d);
+static uint8_t HP3457_GetPunct(uint8_t d);
+static uint8_t HP3457_GetCharCode_Alt(uint8_t d);
+volatile uint8_t dbg_char8 = 0;
+volatile uint8_t dbg_char8_mapped = 0;
+volatile uint8_t dbg_after_build = 0;
+
+// Protocol investigation helpers, not called by the decoder - kept for Live Watch experiments
+#define LOG_TRIGGER_COUNT 256 // Log after 256 samples
+volatile uint8_t bufferFull = 0; // Indicates if the buffer is full
+volatile uint8_t digitCode[12];   // 7-bit HP char code per digit (1..12 -> index 0..11)
+volatile uint8_t punctCode[12];   // 0..3 (none, '.', ':', ',')
+static void DecodeAllDigits(void);
 volatile uint16_t cmdSeen[8] = { 0 };
 volatile uint32_t cmdSeenCount[8] = { 0 };
 static void TrackCmd(uint16_t cmd);
@@ -121,8 +210,6 @@ volatile uint8_t digitVal[12];   // 0–9, or 0xF for blank
 static void DecodeDigitsFromRegA(void);
 volatile int8_t digitDec[12];
 volatile uint8_t  regX[6];          // payload after 0x2E0 (candidate “Reg B”)
-volatile uint32_t cmd2E0Count = 0;  // Live Watch
-volatile uint32_t cmdIgnoredCount = 0;
 volatile uint8_t numStart = 0;
 volatile uint8_t numLen = 0;
 volatile uint8_t numDigits[12];
@@ -135,37 +222,10 @@ volatile uint8_t lsdNibIdx = 4;       // you’ve found this
 volatile uint16_t changedMask;
 volatile uint8_t digitNibIdx[6] = { 4, 5, 6, 7, 8, 9 };  // LSD..MSD
 static uint8_t tenCount = 0;       // 0..9 within current 10-bit chunk
-static uint8_t byteShift = 0;      // assembled 8-bit value, LSB-first
-static uint8_t byteBitCount = 0;   // 0..7
-volatile uint32_t isaBranchHits = 0;
 volatile uint8_t lastCmdRawLSB = 0;  // debug only (same as lastCmdRaw now)
 volatile uint8_t lastCmdRawMSB = 0;  // retained for Live Watch compatibility
 volatile uint8_t lastCmdRaw = 0;
-static uint16_t isa10 = 0;
-static uint8_t  isaBitCount = 0;
-static uint8_t  inaGap2 = 0;      // counts down 2->0 after SYNC falls
-volatile uint16_t lastCmd10 = 0;
-volatile uint32_t cmdOtherCount = 0;
-volatile uint32_t cmd068NearCount = 0;   // counts commands in 0x060..0x06F
-volatile uint32_t cmd0A8NearCount = 0;   // counts commands in 0x0A0..0x0AF
-volatile uint16_t cmdRing[16];
-volatile uint8_t  cmdRingIdx = 0;
-volatile uint32_t regCWrites = 0;
-volatile uint8_t  lastRegC[6];
-volatile uint16_t lastCmdAtRegC = 0;
-volatile uint32_t regCNonZeroWrites = 0;
-volatile uint8_t dbgCode[12];
-static uint8_t HP3457_GetCharCode(uint8_t d);
-static uint8_t HP3457_GetPunct(uint8_t d);
-volatile uint8_t dbgCode_alt[12];
-static uint8_t HP3457_GetCharCode_Alt(uint8_t d);
-volatile char displayStr[13];       // 12 chars + \0
-volatile char punctStr[13];         // punctuation per digit + \0
-volatile char displayWithPunct[32]; // debug/combined string + \0
-volatile uint8_t Annunc[13];   // use indices 1..12, ignore 0
-volatile uint8_t dbg_char8 = 0;
-volatile uint8_t dbg_char8_mapped = 0;
-volatile uint8_t dbg_after_build = 0;
+#endif
 
 //*************************
 //volatile uint8_t dbgCode[12];
@@ -174,30 +234,33 @@ volatile uint8_t dbg_after_build = 0;
 
 //***********************************************************************************
 
-void DMM_HandleO2Clock(void)
+// One O2 rising edge. idr is a single GPIOB->IDR sample, SYNC/PWO/ISA/INA all taken from it.
+// Runs from RAM (no flash wait states), called straight from TIM3_IRQHandler. So do its callees
+// DMM_ProcessCommand/DMM_ProcessDataByte/DMM_LatchFrame, the whole edge never fetches code from flash.
+DMM_RAMFUNC void DMM_HandleO2Clock(uint32_t idr)
 {
-    GPIO_PinState syncLevel = HAL_GPIO_ReadPin(DMM_SYNC_GPIO_Port, DMM_SYNC_Pin);
+    uint8_t syncLevel = (idr & DMM_SYNC_Pin) ? 1u : 0u;
 
-    lastSync = (syncLevel == GPIO_PIN_SET) ? 1 : 0;
-    syncState = lastSync;
+    DMM_TRACE(lastSync = syncLevel);
+    syncState = syncLevel;
 
-    if (syncLevel == GPIO_PIN_SET) syncHighCount++;
-    else                           syncLowCount++;
+    if (syncLevel) DMM_COUNT(syncHighCount);
+    else           DMM_COUNT(syncLowCount);
 
-    O2Count++;
+    DMM_COUNT(O2Count);
 
-    if (HAL_GPIO_ReadPin(DMM_PWO_GPIO_Port, DMM_PWO_Pin) != GPIO_PIN_SET) {
+    if (!(idr & DMM_PWO_Pin)) {
         return;
     }
 
     /* -------- SYNC edge detection & re-alignment -------- */
     {
-        uint8_t syncNow = (syncLevel == GPIO_PIN_SET) ? 1u : 0u;
+        uint8_t syncNow = syncLevel;
 
         if (syncNow != prevSync) {
 
             /* reset common byte assembly */
-            tenCount = 0;
+            DMM_TRACE(tenCount = 0);
             byteShift = 0;
             byteBitCount = 0;
 
@@ -215,74 +278,29 @@ void DMM_HandleO2Clock(void)
     }
 
     /* ================= ISA ================= */
-    if (syncLevel == GPIO_PIN_SET) {
+    if (syncLevel) {
 
-        isaBranchHits++;
+        DMM_COUNT(isaBranchHits);
 
-        uint8_t bit = (uint8_t)HAL_GPIO_ReadPin(DMM_ISA_GPIO_Port, DMM_ISA_Pin) & 1u;
-        lastBit = bit;
-        if (bit) lastBitOnes++;
+        uint8_t bit = (idr & DMM_ISA_Pin) ? 1u : 0u;
+        if (bit) DMM_COUNT(lastBitOnes);
+        DMM_COUNT(ISAcount);
 
-        isaBuffer[isaIndex++] = bit;
-        isaIndex %= MAX_BUFFER_SIZE;
-        ISAcount++;
+        DMM_TRACE(lastBit = bit;
+                  isaBuffer[isaIndex++] = bit;
+                  isaIndex %= MAX_BUFFER_SIZE);
 
         /* ---- build 10-bit ISA command (LSB first) ---- */
         isa10 |= (uint16_t)(bit << isaBitCount);
         isaBitCount++;
 
         if (isaBitCount == 10) {
-
-            lastCmd = isa10;        // FULL 10-bit command
-
-            lastCmd10 = lastCmd;
-
-            // keep a short ring buffer of commands (Live Watch)
-            cmdRing[cmdRingIdx++ & 0x0F] = lastCmd;
-
-            // simple “near” detectors to prove we’re in the right neighborhood
-            if ((lastCmd & 0xFF0) == 0x060) cmd068NearCount++;
-            if ((lastCmd & 0xFF0) == 0x0A0) cmd0A8NearCount++;
-
-            // if not one of the expected ones, count it
-            if (lastCmd != 0x028 && lastCmd != 0x068 && lastCmd != 0x0A8 &&
-                lastCmd != 0x2F0 && lastCmd != 0x2E0 && lastCmd != 0x3F0 &&
-                lastCmd != 0x320) {
-                cmdOtherCount++;
-            }
-
-            lastCmd2 = isa10;
+            uint16_t cmd = isa10;
 
             isa10 = 0;
             isaBitCount = 0;
 
-            /* drop stale payload if any */
-            if (payloadBytesExpected && currentTarget) {
-                cmdIgnoredCount++;
-                payloadBytesExpected = 0;
-                currentTarget = 0;
-                payloadBytesGot = 0;
-            }
-
-            /* ---- command counters ---- */
-            if (lastCmd == 0x028) cmd028Count++;
-            else if ((lastCmd & 0xFF8) == 0x068) cmd068Count++;  // accept 0x068..0x06F
-            else if ((lastCmd & 0xFF8) == 0x0A8) cmd0A8Count++;  // accept 0x0A8..0x0AF
-            else if (lastCmd == 0x2F0) cmd2F0Count++;
-            else if (lastCmd == 0x2E0) cmd2E0Count++;
-
-
-            payloadBytesGot = 0;
-            frameReady = 0;
-
-            /* ---- arm payload capture ---- */
-            if (lastCmd == 0x028) { payloadBytesExpected = 6; currentTarget = 1; }
-            else if (lastCmd == 0x068) { payloadBytesExpected = 6; currentTarget = 2; }
-            else if (lastCmd == 0x0A8) { payloadBytesExpected = 6; currentTarget = 3; }
-            else if (lastCmd == 0x2F0) { payloadBytesExpected = 2; currentTarget = 4; }
-            else { payloadBytesExpected = 0; currentTarget = 0; }
-
-            lastExpected = payloadBytesExpected;
+            DMM_ProcessCommand(cmd);
         }
     }
 
@@ -295,110 +313,330 @@ void DMM_HandleO2Clock(void)
             return;
         }
 
-        uint8_t bit = (uint8_t)HAL_GPIO_ReadPin(DMM_INA_GPIO_Port, DMM_INA_Pin) & 1u;
-        lastBit = bit;
-        if (bit) lastBitOnes++;
+        uint8_t bit = (idr & DMM_INA_Pin) ? 1u : 0u;
+        if (bit) DMM_COUNT(lastBitOnes);
+        DMM_COUNT(INAcount);
 
-        inaBuffer[inaIndex++] = bit;
-        inaIndex %= MAX_BUFFER_SIZE;
-        INAcount++;
+        DMM_TRACE(lastBit = bit;
+                  inaBuffer[inaIndex++] = bit;
+                  inaIndex %= MAX_BUFFER_SIZE);
 
         // INA payload is pure 8-bit bytes (LSB-first) once the 2-gap clocks are skipped
         byteShift |= (uint8_t)(bit << byteBitCount);
         byteBitCount++;
 
         if (byteBitCount == 8) {
-
-            lastDataByte = byteShift;
+            uint8_t dataByte = byteShift;
 
             // reset for next byte
             byteShift = 0;
             byteBitCount = 0;
 
-            if (payloadBytesExpected && currentTarget) {
+            DMM_ProcessDataByte(dataByte);
+        }
+    }
 
-                if (currentTarget == 1 && payloadBytesGot < 6) regA[payloadBytesGot] = lastDataByte;
-                else if (currentTarget == 2 && payloadBytesGot < 6) regB[payloadBytesGot] = lastDataByte;
-                else if (currentTarget == 3 && payloadBytesGot < 6) regC[payloadBytesGot] = lastDataByte;
-                else if (currentTarget == 4 && payloadBytesGot < 2) ann[payloadBytesGot] = lastDataByte;
+}
 
-                payloadBytesGot++;
 
-                if (payloadBytesGot >= payloadBytesExpected) {
+// ISA command table - one byte per 10-bit opcode, built by the compiler, so dispatch in
+// DMM_ProcessCommand() is a single lookup however many opcodes are listed.
+// Low nibble = payload target (handler), high nibble = CMD_STAT_* counter slot.
+// Opcodes not listed are CMD_TGT_NONE / CMD_STAT_OTHER. Every opcode is listed once, no range
+// overlaps an exact entry (clean under -Wextra / -Woverride-init).
+#define CMD_ENTRY(target, stat)     (uint8_t)(((stat) << 4) | (target))
+
+static const uint8_t dmmCmdTable[1024] = {
+    [0x028] = CMD_ENTRY(CMD_TGT_REGA, CMD_STAT_028),    // write A registers (6 bytes)
+
+    [0x060 ... 0x067] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_NEAR060),  // “near” detectors to prove we’re in the right neighborhood
+    [0x068] = CMD_ENTRY(CMD_TGT_REGB, CMD_STAT_068),    // write B registers (6 bytes)
+    [0x069 ... 0x06F] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_068_OTHER), // counted as 0x068, only the exact opcode loads regB
+
+    [0x0A0 ... 0x0A7] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_NEAR0A0),
+    [0x0A8] = CMD_ENTRY(CMD_TGT_REGC, CMD_STAT_0A8),    // write C registers (6 bytes)
+    [0x0A9 ... 0x0AF] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_0A8_OTHER),
+
+    [0x2F0] = CMD_ENTRY(CMD_TGT_ANN,  CMD_STAT_2F0),    // annunciators (2 bytes)
+    [0x2E0] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_2E0),    // ?
+    [0x3F0] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_3F0),    // select the LCD display (1 byte, not used)
+    [0x320] = CMD_ENTRY(CMD_TGT_NONE, CMD_STAT_320),    // toggle display ON/OFF
+};
+
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+// Live Watch counters per CMD_STAT_* slot, up to three each so they count what they always did:
+// near = 0x060..0x06F / 0x0A0..0x0AF, other = anything but the seven known opcodes
+static volatile uint32_t* const dmmCmdStatCounter[CMD_STAT_COUNT][3] = {
+    [CMD_STAT_OTHER]      = { &cmdOtherCount },
+    [CMD_STAT_028]        = { &cmd028Count },
+    [CMD_STAT_068]        = { &cmd068Count, &cmd068NearCount },
+    [CMD_STAT_0A8]        = { &cmd0A8Count, &cmd0A8NearCount },
+    [CMD_STAT_2F0]        = { &cmd2F0Count },
+    [CMD_STAT_2E0]        = { &cmd2E0Count },
+    [CMD_STAT_3F0]        = { &cmd3F0Count },
+    [CMD_STAT_320]        = { &cmd320Count },
+    [CMD_STAT_NEAR060]    = { &cmd068NearCount, &cmdOtherCount },
+    [CMD_STAT_NEAR0A0]    = { &cmd0A8NearCount, &cmdOtherCount },
+    [CMD_STAT_068_OTHER]  = { &cmd068Count, &cmd068NearCount, &cmdOtherCount },
+    [CMD_STAT_0A8_OTHER]  = { &cmd0A8Count, &cmd0A8NearCount, &cmdOtherCount },
+};
+#endif
+
+// Payload length per target
+static const uint8_t dmmTargetLen[CMD_TGT_COUNT] = {
+    [CMD_TGT_NONE] = 0,
+    [CMD_TGT_REGA] = 6,
+    [CMD_TGT_REGB] = 6,
+    [CMD_TGT_REGC] = 6,
+    [CMD_TGT_ANN]  = 2,
+};
+
+
+// Word-level decode stage shared by all capture engines.
+// Called once per complete 10-bit ISA command (LSB-first assembled).
+DMM_RAMFUNC static void DMM_ProcessCommand(uint16_t cmd)
+{
+    uint8_t entry = dmmCmdTable[cmd & 0x3FFu];
+    uint8_t target = entry & 0x0Fu;
 
-                    uint8_t finishedTarget = currentTarget;
+    lastCmd = cmd;          // FULL 10-bit command
 
-                    payloadBytesExpected = 0;
-                    currentTarget = 0;
+    // keep a short ring buffer of commands (Live Watch)
+    DMM_TRACE(lastCmd10 = cmd;
+              lastCmd2 = cmd;
+              cmdRing[cmdRingIdx++ & 0x0F] = cmd);
 
-                    if (finishedTarget == 3) {
-                        // RegC just completed
-                        regCWrites++;
-                        lastCmdAtRegC = lastCmd;   // should be 0x0A8
+    /* ---- command counters ---- */
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+    for (uint8_t k = 0; k < 3 && dmmCmdStatCounter[entry >> 4][k]; k++) {
+        (*dmmCmdStatCounter[entry >> 4][k])++;
+    }
+#endif
 
-                        uint8_t any = 0;
-                        for (int i = 0; i < 6; i++) {
-                            lastRegC[i] = regC[i];
-                            any |= regC[i];
-                        }
-                        if (any) regCNonZeroWrites++;
-                    }
+    /* drop stale payload if any */
+    if (payloadBytesExpected && currentTarget) {
+        DMM_COUNT(cmdIgnoredCount);
+    }
 
-                    if (finishedTarget == 1 ||
-                        finishedTarget == 2 ||
-                        finishedTarget == 3) {
-                        //DecodeAllDigits();
-                        HP3457_BuildDisplayString(displayStr, punctStr);
+    payloadBytesGot = 0;
+    DMM_TRACE(frameReady = 0);
 
+    /* ---- arm payload capture ---- */
+    payloadBytesExpected = dmmTargetLen[target];
+    currentTarget = target;
 
-                        dbg_after_build = 1;                          // marker: we reached here
-                        dbg_char8 = (uint8_t)displayStr[8];           // what actually ended up in the string
-                        dbg_char8_mapped = (uint8_t)displayStr[8];    // should be '=' (0x3D) if your mapping is in use
+    DMM_TRACE(lastExpected = payloadBytesExpected);
+}
 
 
+// Word-level decode stage shared by all capture engines.
+// Called once per complete 8-bit INA payload byte (LSB-first assembled).
+DMM_RAMFUNC static void DMM_ProcessDataByte(uint8_t dataByte)
+{
+    DMM_TRACE(lastDataByte = dataByte);
 
-                        int k = 0;
-                        for (int i = 0; i < 12; i++) {
-                            displayWithPunct[k++] = displayStr[i];
-                            if (punctStr[i] != ' ') displayWithPunct[k++] = punctStr[i]; // '.',':',','
-                        }
-                        displayWithPunct[k] = '\0';
+    if (payloadBytesExpected && currentTarget) {
 
+        if (currentTarget == CMD_TGT_REGA && payloadBytesGot < 6) regA[payloadBytesGot] = dataByte;
+        else if (currentTarget == CMD_TGT_REGB && payloadBytesGot < 6) regB[payloadBytesGot] = dataByte;
+        else if (currentTarget == CMD_TGT_REGC && payloadBytesGot < 6) regC[payloadBytesGot] = dataByte;
+        else if (currentTarget == CMD_TGT_ANN && payloadBytesGot < 2) ann[payloadBytesGot] = dataByte;
 
-                        for (int i = 0; i < 12; i++) {
-                            uint8_t d = (uint8_t)(i + 1);   // because we now build display left-to-right with d=1..12
-                            dbgCode[i] = HP3457_GetCharCode(d);
-                        }
+        payloadBytesGot++;
 
+        if (payloadBytesGot >= payloadBytesExpected) {
 
-                        for (int i = 0; i < 12; i++) {
-                            uint8_t d = (uint8_t)(i + 1);
-                            dbgCode_alt[i] = HP3457_GetCharCode_Alt(d);
-                        }
+            uint8_t finishedTarget = currentTarget;
 
-                        frameReady = 1;
+            payloadBytesExpected = 0;
+            currentTarget = CMD_TGT_NONE;
 
-                    }
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+            if (finishedTarget == CMD_TGT_REGC) {
+                // RegC just completed
+                regCWrites++;
+                DMM_TRACE(lastCmdAtRegC = lastCmd);   // should be 0x0A8
 
-                    if (finishedTarget == 4) {
-                        // ann[0] and ann[1] contain the two bytes received after 0x2F0
-                        // Bits are transmitted LSB-first overall, and the forum mapping says
-                        // bit position 12..1 = SMPL..SHIFT (reverse order on the wire).
-                        uint16_t bits = (uint16_t)ann[0] | ((uint16_t)ann[1] << 8);
+                uint8_t any = 0;
+                for (int i = 0; i < 6; i++) {
+                    DMM_TRACE(lastRegC[i] = regC[i]);
+                    any |= regC[i];
+                }
+                if (any) regCNonZeroWrites++;
+            }
+#endif
 
-                        // Map to Annunc[1..12] where:
-                        // 1=SHIFT ... 12=SMPL (matches the forum table)
-                        for (int pos = 1; pos <= 12; pos++) {
-                            Annunc[pos] = (bits >> (pos - 1)) & 1u;
-                        }
-                    }
+            if (finishedTarget == CMD_TGT_REGA ||
+                finishedTarget == CMD_TGT_REGB ||
+                finishedTarget == CMD_TGT_REGC) {
+                DMM_LatchFrame();      // string building runs later in DMM_FrameBuild()
 
+            }
 
-                }
+            if (finishedTarget == CMD_TGT_ANN) {
+                DMM_LatchFrame();      // annunciator mapping also runs in DMM_FrameBuild()
             }
+
+
+        }
+    }
+}
+
+
+// Completed regA/regB/regC/ann - copy the raw bytes out (the next command overwrites them while they
+// arrive) and hand the string building to the PendSV stage, off the capture interrupt.
+// Only one target is ever being received, so at this point all four are whole.
+// The 3457A resends identical payloads many times a second, those stop here: nothing is pended
+// and the frame generation (DMM_Frame.seq) does not move, so the renderer has nothing to do.
+DMM_RAMFUNC static void DMM_LatchFrame(void)
+{
+    uint8_t diff = 0;
+
+    for (int i = 0; i < 6; i++) {
+        diff |= (uint8_t)(regALatched[i] ^ regA[i]);
+        diff |= (uint8_t)(regBLatched[i] ^ regB[i]);
+        diff |= (uint8_t)(regCLatched[i] ^ regC[i]);
+        regALatched[i] = regA[i];
+        regBLatched[i] = regB[i];
+        regCLatched[i] = regC[i];
+    }
+    diff |= (uint8_t)(annLatched[0] ^ ann[0]);
+    diff |= (uint8_t)(annLatched[1] ^ ann[1]);
+    annLatched[0] = ann[0];
+    annLatched[1] = ann[1];
+
+    if (!diff && frameLatchSeq != 0) {
+        DMM_COUNT(frameUnchangedCount);
+        return;
+    }
+
+    frameLatchTick = uwTick;        // HAL_GetTick() without the call into flash
+    frameLatchSeq++;
+
+#if DMM_DEFERRED_BUILD
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#else
+    DMM_FrameBuild();
+#endif
+}
+
+
+// Builds displayStr/punctStr/displayWithPunct and the debug codes from the latched registers.
+// Runs from PendSV_Handler (lowest priority), so the capture interrupts can preempt it at any time.
+void DMM_FrameBuild(void)
+{
+    DMM_CYCLES_BEGIN();
+    uint32_t seq;
+    uint32_t tick;
+    uint16_t bits;
+
+    // Retry if a newer frame was latched while copying
+    do {
+        seq = frameLatchSeq;
+        for (int i = 0; i < 6; i++) {
+            regAFrame[i] = regALatched[i];
+            regBFrame[i] = regBLatched[i];
+            regCFrame[i] = regCLatched[i];
         }
+        bits = (uint16_t)annLatched[0] | ((uint16_t)annLatched[1] << 8);
+        tick = frameLatchTick;
+    } while (seq != frameLatchSeq);
+
+    HP3457_BuildDisplayString((char*)displayStr, (char*)punctStr);     // PendSV is the only writer
+
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
+    dbg_after_build = 1;                          // marker: we reached here
+    dbg_char8 = (uint8_t)displayStr[8];           // what actually ended up in the string
+    dbg_char8_mapped = (uint8_t)displayStr[8];    // should be '=' (0x3D) if your mapping is in use
+#endif
+
+    int k = 0;
+    for (int i = 0; i < 12; i++) {
+        displayWithPunct[k++] = displayStr[i];
+        if (punctStr[i] != ' ') displayWithPunct[k++] = punctStr[i]; // '.',':',','
+    }
+    displayWithPunct[k] = '\0';
+
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
+    // Reference per-digit decode, cross-checked against HP3457_DecodeFrame()
+    for (int i = 0; i < 12; i++) {
+        uint8_t d = (uint8_t)(i + 1);   // because we now build display left-to-right with d=1..12
+        dbgCode[i] = HP3457_GetCharCode(d);
+        if (dbgCode[i] != frameCode[i] || HP3457_GetPunct(d) != framePunct[i]) decodeMismatchCount++;
+    }
+
+    for (int i = 0; i < 12; i++) {
+        uint8_t d = (uint8_t)(i + 1);
+        dbgCode_alt[i] = HP3457_GetCharCode_Alt(d);
+    }
+#endif
+
+    // ann[0] and ann[1] contain the two bytes received after 0x2F0
+    // Bits are transmitted LSB-first overall, and the forum mapping says
+    // bit position 12..1 = SMPL..SHIFT (reverse order on the wire).
+    // Map to Annunc[1..12] where:
+    // 1=SHIFT ... 12=SMPL (matches the forum table)
+    for (int pos = 1; pos <= 12; pos++) {
+        Annunc[pos] = (bits >> (pos - 1)) & 1u;
     }
 
+    DMM_FramePublish(seq, tick);
+
+    DMM_TRACE(frameReady = 1);
+
+    DMM_CYCLES_END(frameBuildCycles, frameBuildCyclesMax);
+}
+
+
+// Seqlock writer - DMM_FrameBuild() is the only writer, readers use DMM_FrameSnapshot().
+// dmmFrameLock is odd while the frame is being rewritten.
+static void DMM_FramePublish(uint32_t seq, uint32_t tick)
+{
+    dmmFrameLock++;
+    __DMB();
+
+    dmmFrame.seq = seq;
+    dmmFrame.tick = tick;
+    for (int i = 0; i < 32; i++) dmmFrame.text[i] = displayWithPunct[i];
+    for (int i = 0; i < 13; i++) dmmFrame.chars[i] = displayStr[i];
+    for (int i = 0; i < 13; i++) dmmFrame.punct[i] = punctStr[i];
+    for (int i = 0; i < 13; i++) dmmFrame.annunc[i] = Annunc[i];
+
+    __DMB();
+    dmmFrameLock++;
+}
+
+
+// Sequence number of the latest published frame, to skip a snapshot when nothing changed
+uint32_t DMM_FrameGeneration(void)
+{
+    return dmmFrame.seq;        // single aligned word, no lock needed
+}
+
+
+// Consistent copy of the latest decoded frame, no interrupt masking. Retries if the
+// decoder published a new frame while copying (the copy is ~70 bytes, the writer
+// runs at most once per 3457A frame, so a retry is rare and never repeats for long).
+void DMM_FrameSnapshot(DMM_Frame* out)
+{
+    uint32_t lock;
+
+    do {
+        lock = dmmFrameLock;
+        __DMB();
+
+        out->seq = dmmFrame.seq;
+        out->tick = dmmFrame.tick;
+        for (int i = 0; i < 32; i++) out->text[i] = dmmFrame.text[i];
+        for (int i = 0; i < 13; i++) out->chars[i] = dmmFrame.chars[i];
+        for (int i = 0; i < 13; i++) out->punct[i] = dmmFrame.punct[i];
+        for (int i = 0; i < 13; i++) out->annunc[i] = dmmFrame.annunc[i];
+
+        __DMB();
+        if (lock & 1u) continue;                // writer was mid-update
+        if (lock == dmmFrameLock) return;
+        DMM_COUNT(frameSnapshotRetries);
+    } while (1);
 }
 
 
@@ -427,12 +665,25 @@ void MX_TIM3_Init(void) {
     sConfigIC.ICPolarity = TIM_INPUTCHANNELPOLARITY_RISING;
     sConfigIC.ICSelection = TIM_ICSELECTION_DIRECTTI;
     sConfigIC.ICPrescaler = TIM_ICPSC_DIV1;
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+    sConfigIC.ICFilter = DMA_O2_IC_FILTER;      // IC4F filters TI4, which also feeds IC3 below
+#else
     sConfigIC.ICFilter = 0;
+#endif
 
     if (HAL_TIM_IC_ConfigChannel(&htim3, &sConfigIC, TIM_CHANNEL_4) != HAL_OK) {
         Error_Handler();
     }
 
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+    // The CH4 DMA request shares DMA1 Channel 3 with SPI1_TX (LT7680), so O2 is also routed
+    // to IC3 (TI4 -> IC3) whose DMA request is on DMA1 Channel 2
+    sConfigIC.ICSelection = TIM_ICSELECTION_INDIRECTTI;
+    if (HAL_TIM_IC_ConfigChannel(&htim3, &sConfigIC, TIM_CHANNEL_3) != HAL_OK) {
+        Error_Handler();
+    }
+#endif
+
     sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
     sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
     if (HAL_TIMEx_MasterConfigSynchronization(&htim3, &sMasterConfig) != HAL_OK) {
@@ -441,8 +692,24 @@ void MX_TIM3_Init(void) {
 }
 
 
-void TIM3_IRQHandler(void) {
+// ISR engine: no HAL dispatch or callback - CC4IF is cleared directly and GPIOB->IDR is read once,
+// first thing, so all four 3457A signals come from the same instant right after the O2 edge.
+DMM_RAMFUNC void TIM3_IRQHandler(void) {
+    DMM_CYCLES_BEGIN();
+
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_ISR
+    uint32_t idr = DMM_SYNC_GPIO_Port->IDR;
+
+    if (TIM3->SR & TIM_SR_CC4IF) {
+        TIM3->SR = ~(uint32_t)TIM_SR_CC4IF;    // rc_w0, other flags untouched
+        DMM_HandleO2Clock(idr);
+    }
+#else
     HAL_TIM_IRQHandler(&htim3);
+#endif
+
+    DMM_CYCLES_END(o2IsrCycles, o2IsrCyclesMax);
+    DMM_STAT(if (o2IsrCycles > DMM_O2_CYCLE_BUDGET) o2IsrOverBudget++);
 }
 
 
@@ -457,6 +724,10 @@ void DMM_HandleSyncState(void) {
 
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
     if (GPIO_Pin == DMM_SYNC_Pin) {
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+        DMM_Spi2SyncEdge();     // Time critical, must finish before the next O2 rising edge
+#endif
+
         // Update syncState or perform your custom logic
         syncState = HAL_GPIO_ReadPin(DMM_SYNC_GPIO_Port, DMM_SYNC_Pin);
 
@@ -466,16 +737,290 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
 }
 
 
-void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef* htim) {
-    if (htim->Instance == TIM3) {
-        if (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_4) {
-            // This fires on every real O2 rising edge (PB1 / TIM3_CH4)
-            DMM_HandleO2Clock();
+// Start whichever 3457A capture engine is selected by DMM_CAPTURE_ENGINE (main.h)
+void DMM_CaptureStart(void)
+{
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+    // DWT cycle counter for the o2IsrCycles / frameBuildCycles measurements
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    HAL_NVIC_SetPriority(PendSV_IRQn, 15, 0);   // DMM_FrameBuild() below every capture interrupt
+
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+    MX_SPI2_Init();
+    if (HAL_SPI_Receive_DMA(&hspi2, spi2Ring, SPI2_RING_SIZE) != HAL_OK) {
+        Error_Handler();
+    }
+#elif DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+    DMM_DmaCaptureStart();
+#else
+    // Start TIM3 input-capture on CH4 (PB1 = TIM3_CH4)
+    HAL_TIM_IC_Start_IT(&htim3, TIM_CHANNEL_4);
+#endif
+}
+
+
+// Call from the main loop - flushes captured words that no interrupt has picked up yet
+// (e.g. the last transaction of a frame, which is not followed by another SYNC edge)
+void DMM_CaptureService(void)
+{
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+    NVIC_SetPendingIRQ(DMA1_Channel4_IRQn);     // Drain runs in the DMA IRQ, never in two contexts
+#elif DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+    NVIC_SetPendingIRQ(DMA1_Channel2_IRQn);     // same for the GPIOB sample ring
+#endif
+}
+
+
+// Word-level decoder for one SYNC-delimited transaction, no per-bit work.
+// words[] holds the transaction bytes LSB-first as they came off the wire:
+//   words[0]           = ISA bits 0-7
+//   words[1] bits 0-1  = ISA bits 8-9, bits 2-3 = the 2 gap clocks, bits 4-7 = INA payload byte 0 bits 0-3
+//   payload byte k     = words[k+1] >> 4 | words[k+2] << 4
+// Resumable: pass back the returned position as more words arrive (0 = command not decoded yet).
+// No HAL or capture-engine dependencies, so recorded streams can be fed straight in.
+uint8_t DMM_DecodeWords(const uint8_t* words, uint8_t len, uint8_t pos)
+{
+    if (pos == 0) {
+        if (len < 2) return 0;
+        DMM_ProcessCommand((uint16_t)(words[0] | ((uint16_t)(words[1] & 0x03u) << 8)));
+        pos = 1;
+    }
+
+    while (payloadBytesExpected && (uint8_t)(pos + 1) < len) {
+        DMM_ProcessDataByte((uint8_t)((words[pos] >> 4) | (words[pos + 1] << 4)));
+        pos++;
+    }
+
+    return pos;
+}
+
+
+//***********************************************************************************
+// SPI2 capture engine - O2 (linked to PB13) clocks SPI2 as a slave and DMA fills a byte ring.
+// SYNC rising : SPI2 is re-enabled so byte alignment restarts on ISA bit 0, input = MISO (ISA) via BIDIMODE.
+// SYNC falling: input mux switched to MOSI (INA) on the fly, the bit count keeps running through the gap.
+// The CPU only wakes per SYNC edge; decoding happens in the DMA1 Channel 4 IRQ, right below SYNC (main.h).
+
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+
+uint8_t spi2Ring[SPI2_RING_SIZE];
+static volatile uint16_t spi2TxnStart[SPI2_TXN_COUNT];  // ring index at each SYNC rising edge
+static volatile uint8_t spi2TxnHead = 0;                // written by SYNC EXTI only
+static uint8_t spi2TxnTail = 0;                         // written by DMM_Spi2Drain only
+static uint8_t spi2TxnPos = 0;                          // DMM_DecodeWords position in the tail transaction
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+volatile uint32_t spi2TxnCount = 0;                     // Live Watch
+volatile uint32_t spi2TxnOverrun = 0;                   // Live Watch - drain fell SPI2_TXN_COUNT behind
+#endif
+
+
+static uint16_t Spi2WriteIndex(void)
+{
+    return (uint16_t)((SPI2_RING_SIZE - __HAL_DMA_GET_COUNTER(&hdma_spi2_rx)) & (SPI2_RING_SIZE - 1));
+}
+
+
+void DMM_Spi2SyncEdge(void)
+{
+    if (HAL_GPIO_ReadPin(DMM_SYNC_GPIO_Port, DMM_SYNC_Pin) == GPIO_PIN_SET) {
+
+        // ISA phase - drop the partial tail of the previous transaction and realign
+        SPI2->CR1 &= ~SPI_CR1_SPE;
+        SPI2->CR1 = (SPI2->CR1 & ~SPI_CR1_RXONLY) | SPI_CR1_BIDIMODE;  // BIDIOE = 0, receive on MISO
+        SPI2->CR1 |= SPI_CR1_SPE;
+
+        uint16_t start = Spi2WriteIndex();
+        if (HAL_GPIO_ReadPin(DMM_PWO_GPIO_Port, DMM_PWO_Pin) != GPIO_PIN_SET) {
+            start |= SPI2_TXN_NOPWO;                // display not selected, decoder skips it
+        }
+
+        if ((uint8_t)(spi2TxnHead - spi2TxnTail) < SPI2_TXN_COUNT) {
+            spi2TxnStart[spi2TxnHead & (SPI2_TXN_COUNT - 1)] = start;
+            spi2TxnHead++;
         }
+        else {
+            DMM_COUNT(spi2TxnOverrun);              // merges into the previous transaction
+        }
+        DMM_COUNT(spi2TxnCount);
+
+        NVIC_SetPendingIRQ(DMA1_Channel4_IRQn);     // previous transaction is now complete
+    }
+    else {
+        // INA phase - switch input only, SPE stays set so the gap clocks are counted
+        SPI2->CR1 = (SPI2->CR1 & ~SPI_CR1_BIDIMODE) | SPI_CR1_RXONLY;
     }
 }
 
 
+// Decode every transaction that has words available. Runs in DMA1 Channel 4 IRQ context only.
+void DMM_Spi2Drain(void)
+{
+    uint8_t words[16];
+
+    while (spi2TxnTail != spi2TxnHead) {
+
+        uint8_t next = (uint8_t)(spi2TxnTail + 1);
+        uint8_t closed = (next != spi2TxnHead);
+        uint16_t start = spi2TxnStart[spi2TxnTail & (SPI2_TXN_COUNT - 1)];
+        uint16_t end = closed ? spi2TxnStart[next & (SPI2_TXN_COUNT - 1)] : Spi2WriteIndex();
+        end &= (SPI2_RING_SIZE - 1);
+
+        if (!(start & SPI2_TXN_NOPWO)) {
+            start &= (SPI2_RING_SIZE - 1);
+            uint16_t len = (uint16_t)((end - start) & (SPI2_RING_SIZE - 1));
+            if (len > sizeof(words)) len = sizeof(words);   // only 2 + 12 words are ever needed
+
+            for (uint16_t i = 0; i < len; i++) {
+                words[i] = spi2Ring[(start + i) & (SPI2_RING_SIZE - 1)];
+            }
+            spi2TxnPos = DMM_DecodeWords(words, (uint8_t)len, spi2TxnPos);
+        }
+
+        if (!closed) break;                         // still receiving, resume from spi2TxnPos next time
+
+        spi2TxnTail = next;
+        spi2TxnPos = 0;
+    }
+}
+
+#endif // DMM_CAPTURE_ENGINE == DMM_CAPTURE_SPI2
+
+
+//***********************************************************************************
+// GPIOB DMA capture engine - every O2 rising edge (TIM3 IC3 via TI4) makes DMA1 Channel 2 copy
+// GPIOB->IDR into a circular half-word ring. One snapshot holds SYNC, PWO, ISA and INA together,
+// so the per-bit cost is a single DMA beat. The half/full transfer interrupt (priority 3, main.h)
+// decodes the whole batch with the same bit state machine as DMM_HandleO2Clock().
+
+#if DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+
+DMA_HandleTypeDef hdma_tim3_ch3;
+uint16_t o2SampleRing[DMA_SAMPLE_RING_SIZE];
+static uint16_t o2SampleTail = 0;                       // written by DMM_DmaDrain only
+#if DMM_INSTRUMENT >= DMM_INSTR_COUNTERS
+volatile uint32_t o2DmaHalfCount = 0;                   // Live Watch - half/full transfer interrupts
+volatile uint16_t o2BatchMax = 0;                       // Live Watch - largest batch, keep well below DMA_SAMPLE_RING_SIZE
+#endif
+
+
+static void DmaSampleHalfCallback(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    DMM_COUNT(o2DmaHalfCount);                  // decoding follows in DMA1_Channel2_IRQHandler
+}
+
+
+static void DMM_DmaCaptureStart(void)
+{
+    hdma_tim3_ch3.Instance = DMA1_Channel2;
+    hdma_tim3_ch3.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_tim3_ch3.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_tim3_ch3.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_tim3_ch3.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;   // PB0..PB15 only
+    hdma_tim3_ch3.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma_tim3_ch3.Init.Mode = DMA_CIRCULAR;
+    hdma_tim3_ch3.Init.Priority = DMA_PRIORITY_VERY_HIGH;              // must win over SPI1_TX
+    if (HAL_DMA_Init(&hdma_tim3_ch3) != HAL_OK) {
+        Error_Handler();
+    }
+    __HAL_LINKDMA(&htim3, hdma[TIM_DMA_ID_CC3], hdma_tim3_ch3);
+
+    hdma_tim3_ch3.XferHalfCpltCallback = DmaSampleHalfCallback;        // non-NULL enables the HT interrupt
+    hdma_tim3_ch3.XferCpltCallback = DmaSampleHalfCallback;
+
+    if (HAL_DMA_Start_IT(&hdma_tim3_ch3, (uint32_t)&DMM_SYNC_GPIO_Port->IDR,
+                         (uint32_t)o2SampleRing, DMA_SAMPLE_RING_SIZE) != HAL_OK) {
+        Error_Handler();
+    }
+
+    __HAL_TIM_ENABLE_DMA(&htim3, TIM_DMA_CC3);
+    HAL_TIM_IC_Start(&htim3, TIM_CHANNEL_3);   // no TIM3 interrupt in this mode
+}
+
+
+// Batch version of DMM_HandleO2Clock() - one GPIOB->IDR snapshot per O2 rising edge.
+// State is held in locals for the loop and written back once per batch.
+static void DMM_DecodeSamples(const uint16_t* s, uint16_t n)
+{
+    uint8_t  syncPrev = prevSync;
+    uint16_t cmd = isa10;
+    uint8_t  cmdBits = isaBitCount;
+    uint8_t  gap = inaGap2;
+    uint8_t  shift = byteShift;
+    uint8_t  bits = byteBitCount;
+
+    for (uint16_t i = 0; i < n; i++) {
+        uint16_t idr = s[i];
+
+        if (!(idr & DMM_PWO_Pin)) continue;
+
+        uint8_t syncNow = (idr & DMM_SYNC_Pin) ? 1u : 0u;
+
+        if (syncNow != syncPrev) {
+            syncPrev = syncNow;
+            shift = 0;
+            bits = 0;
+            if (syncNow) { cmd = 0; cmdBits = 0; }     // entering ISA phase
+            else         { gap = 2; }                   // entering INA phase → 2 dummy clocks
+        }
+
+        if (syncNow) {
+            cmd |= (uint16_t)(((idr & DMM_ISA_Pin) ? 1u : 0u) << cmdBits);
+            if (++cmdBits == 10) {
+                DMM_ProcessCommand(cmd);
+                cmd = 0;
+                cmdBits = 0;
+            }
+        }
+        else if (gap) {
+            gap--;
+        }
+        else {
+            shift |= (uint8_t)(((idr & DMM_INA_Pin) ? 1u : 0u) << bits);
+            if (++bits == 8) {
+                DMM_ProcessDataByte(shift);
+                shift = 0;
+                bits = 0;
+            }
+        }
+    }
+
+    prevSync = syncPrev;
+    isa10 = cmd;
+    isaBitCount = cmdBits;
+    inaGap2 = gap;
+    byteShift = shift;
+    byteBitCount = bits;
+
+    DMM_STAT(O2Count += n;
+             if (n > o2BatchMax) o2BatchMax = n);
+}
+
+
+// Decode every sample written since the last call. Runs in DMA1 Channel 2 IRQ context only.
+void DMM_DmaDrain(void)
+{
+    uint16_t head = (uint16_t)((DMA_SAMPLE_RING_SIZE - __HAL_DMA_GET_COUNTER(&hdma_tim3_ch3)) & (DMA_SAMPLE_RING_SIZE - 1));
+
+    if (head < o2SampleTail) {
+        DMM_DecodeSamples(&o2SampleRing[o2SampleTail], (uint16_t)(DMA_SAMPLE_RING_SIZE - o2SampleTail));
+        o2SampleTail = 0;
+    }
+    if (head != o2SampleTail) {
+        DMM_DecodeSamples(&o2SampleRing[o2SampleTail], (uint16_t)(head - o2SampleTail));
+        o2SampleTail = head;
+    }
+}
+
+#endif // DMM_CAPTURE_ENGINE == DMM_CAPTURE_DMA
+
+
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
+
 static uint8_t DecodeHpDigitCode(uint8_t digit1to12, uint8_t* punctOut)
 {
     // digit1to12: 1..12
@@ -641,7 +1186,35 @@ static void ExtractRegANibbles(void)
     }
 }
 
+#endif // DMM_INSTRUMENT >= DMM_INSTR_TRACE
+
+
+// All 12 character codes and punctuation from one register set in a single pass, no per-bit work.
+// Byte bi of each register holds digit d = 12-2*bi in its low half and d = 11-2*bi in its high half:
+//   code  = RegA nibble | RegB 2 bits << 4 | RegC 1 bit << 6    (low half: bits 3..0 / 1..0 / 0)
+//   punct = RegB next 2 bits                                     (high half: bits 7..4 / 5..4 / 4)
+// Same result as HP3457_GetCharCode()/HP3457_GetPunct() per digit, with the seven bit moves
+// reduced to three masks because the fields are already contiguous and in order.
+static void HP3457_DecodeFrame(const uint8_t a[6], const uint8_t b[6], const uint8_t c[6],
+                               uint8_t code12[12], uint8_t punct12[12])
+{
+    for (int bi = 0; bi < 6; bi++) {
+        uint8_t av = a[bi];
+        uint8_t bv = b[bi];
+        uint8_t cv = c[bi];
+        int even = 11 - 2 * bi;         // index of digit 12-2*bi
+        int odd = even - 1;             // index of digit 11-2*bi
+
+        code12[even] = (uint8_t)((av & 0x0Fu) | ((bv & 0x03u) << 4) | ((cv & 0x01u) << 6));
+        code12[odd] = (uint8_t)((av >> 4) | (bv & 0x30u) | ((cv & 0x10u) << 2));
+
+        punct12[even] = (uint8_t)((bv >> 2) & 0x03u);
+        punct12[odd] = (uint8_t)(bv >> 6);
+    }
+}
+
 
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
 // Returns 7-bit HP char code (0..127) for digit number d = 1..12
 static uint8_t HP3457_GetCharCode(uint8_t d)
 {
@@ -649,9 +1222,9 @@ static uint8_t HP3457_GetCharCode(uint8_t d)
     uint8_t bi = (12 - d) / 2;          // 0..5
     uint8_t even = ((d & 1u) == 0u);    // digit number even?
 
-    uint8_t a = regA[bi];
-    uint8_t b = regB[bi];
-    uint8_t c = regC[bi];
+    uint8_t a = regAFrame[bi];
+    uint8_t b = regBFrame[bi];
+    uint8_t c = regCFrame[bi];
 
     uint8_t code = 0;
 
@@ -695,7 +1268,7 @@ static uint8_t HP3457_GetPunct(uint8_t d)
     uint8_t bi = (12 - d) / 2;          // 0..5
     uint8_t even = ((d & 1u) == 0u);
 
-    uint8_t b = regB[bi];
+    uint8_t b = regBFrame[bi];
 
     if (even) {
         // even digits: RegB bit3..2
@@ -706,6 +1279,7 @@ static uint8_t HP3457_GetPunct(uint8_t d)
         return (uint8_t)((b >> 6) & 0x03u);
     }
 }
+#endif
 
 
 static char HP3457_CodeToAscii(uint8_t code)
@@ -728,19 +1302,20 @@ static char HP3457_CodeToAscii(uint8_t code)
 }
 
 
+// Builds from regAFrame/regBFrame/regCFrame, leaves the raw codes in frameCode/framePunct
 void HP3457_BuildDisplayString(char out12[13], char punct12[13])
 {
-    for (int i = 0; i < 12; i++) {
-        uint8_t d = (uint8_t)(i + 1);   // d = 1..12  (was 12-i)
+    static const char punctChar[4] = { ' ', '.', ':', ',' };
 
-        uint8_t code = HP3457_GetCharCode(d);
+    HP3457_DecodeFrame(regAFrame, regBFrame, regCFrame, frameCode, framePunct);
+
+    for (int i = 0; i < 12; i++) {
+        uint8_t code = frameCode[i];    // d = i + 1, left to right
 
         if (code == 0x3F) code = 0x3D;   // force '='
 
         out12[i] = HP3457_CodeToAscii(code);
-
-        uint8_t p = HP3457_GetPunct(d);
-        punct12[i] = (p == 1) ? '.' : (p == 2) ? ':' : (p == 3) ? ',' : ' ';
+        punct12[i] = punctChar[framePunct[i]];
     }
 
     // Use this to live watch in order to get code for ? chars - live watch ---> dbgCode[12]
@@ -754,14 +1329,15 @@ void HP3457_BuildDisplayString(char out12[13], char punct12[13])
 }
 
 
+#if DMM_INSTRUMENT >= DMM_INSTR_TRACE
 static uint8_t HP3457_GetCharCode_Alt(uint8_t d)
 {
     uint8_t bi = (12 - d) / 2;
     uint8_t even = ((d & 1u) == 0u);
 
-    uint8_t a = regA[bi];
-    uint8_t b = regB[bi];
-    uint8_t c = regC[bi];
+    uint8_t a = regAFrame[bi];
+    uint8_t b = regBFrame[bi];
+    uint8_t c = regCFrame[bi];
 
     uint8_t code = 0;
 
@@ -789,4 +1365,5 @@ static uint8_t HP3457_GetCharCode_Alt(uint8_t d)
     }
 
     return code;
-}
\ No newline at end of file
+}
+#endif
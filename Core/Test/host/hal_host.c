@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    hal_host.c
+  * @brief   Host stand-ins for the peripherals and HAL calls the firmware
+  *          sources reference, see hal_host.h
+  ******************************************************************************
+  * Init calls succeed and do nothing, pins read low, the tick only moves when a
+  * test moves it. Nothing here models the 3457A or the LT7680 (the simulator in
+  * Core/Test/sim adds SPI1 and the LT7680 on top).
+*/
+
+#include "hal_host.h"
+
+GPIO_TypeDef hostGPIOA, hostGPIOB, hostGPIOC;
+SPI_TypeDef hostSPI1, hostSPI2;
+TIM_TypeDef hostTIM2, hostTIM3;
+SCB_Type hostSCB;
+DWT_Type hostDWT;
+CoreDebug_Type hostCoreDebug;
+
+__IO uint32_t uwTick;
+uint32_t hostNvicPending;
+void (*hostNvicHook)(IRQn_Type irq);
+uint32_t SystemCoreClock = 72000000;
+
+TIM_HandleTypeDef htim3;
+SPI_HandleTypeDef hspi1;
+SPI_HandleTypeDef hspi2;
+DMA_HandleTypeDef hdma_spi2_rx;
+
+
+void HostNvicSetPending(IRQn_Type irq)
+{
+    if (irq >= 0 && irq < 32) hostNvicPending |= 1u << irq;
+    if (hostNvicHook != NULL) hostNvicHook(irq);
+}
+
+void Error_Handler(void)
+{
+    __builtin_trap();
+}
+
+uint32_t HAL_GetTick(void) { return uwTick; }
+void HAL_Delay(uint32_t delay) { uwTick += delay; }
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t pre, uint32_t sub) { (void)irq; (void)pre; (void)sub; }
+void HAL_NVIC_EnableIRQ(IRQn_Type irq) { (void)irq; }
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* port, uint16_t pin) { return (port->IDR & pin) ? GPIO_PIN_SET : GPIO_PIN_RESET; }
+void HAL_GPIO_TogglePin(GPIO_TypeDef* port, uint16_t pin) { port->ODR ^= pin; }
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state)
+{
+    if (state == GPIO_PIN_SET) port->BSRR = pin;
+    else port->BRR = pin;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef* h) { (void)h; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef* h, TIM_ClockConfigTypeDef* c) { (void)h; (void)c; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef* h, TIM_IC_InitTypeDef* c, uint32_t ch) { (void)h; (void)c; (void)ch; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef* h, TIM_MasterConfigTypeDef* c) { (void)h; (void)c; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef* h, uint32_t ch) { (void)h; (void)ch; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_IC_Start(TIM_HandleTypeDef* h, uint32_t ch) { (void)h; (void)ch; return HAL_OK; }
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef* h) { (void)h; }
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef* h) { (void)h; return HAL_OK; }
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef* h, uint32_t src, uint32_t dst, uint32_t len) { (void)h; (void)src; (void)dst; (void)len; return HAL_OK; }
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef* h, uint8_t* data, uint16_t len) { (void)h; (void)data; (void)len; return HAL_OK; }
+void MX_SPI2_Init(void) { }
@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @file    hal_host.h
+  * @brief   Host (Linux) build of the firmware sources - forced in front of
+  *          every translation unit with gcc -include, see Core/Test/Makefile
+  ******************************************************************************
+  * The real HAL/CMSIS headers are used so every type and field matches the
+  * target, then the peripheral instances the code touches at run time are
+  * pointed at plain host structs instead of their STM32 addresses.
+*/
+
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+#include "stm32f1xx_hal.h"
+
+extern GPIO_TypeDef hostGPIOA, hostGPIOB, hostGPIOC;
+extern SPI_TypeDef hostSPI1, hostSPI2;
+extern TIM_TypeDef hostTIM2, hostTIM3;
+extern SCB_Type hostSCB;
+extern DWT_Type hostDWT;
+extern CoreDebug_Type hostCoreDebug;
+
+#undef GPIOA
+#define GPIOA					(&hostGPIOA)
+#undef GPIOB
+#define GPIOB					(&hostGPIOB)
+#undef GPIOC
+#define GPIOC					(&hostGPIOC)
+#undef SPI1
+#define SPI1					(&hostSPI1)
+#undef SPI2
+#define SPI2					(&hostSPI2)
+#undef TIM2
+#define TIM2					(&hostTIM2)
+#undef TIM3
+#define TIM3					(&hostTIM3)
+#undef SCB
+#define SCB						(&hostSCB)
+#undef DWT
+#define DWT						(&hostDWT)
+#undef CoreDebug
+#define CoreDebug				(&hostCoreDebug)
+
+// Core intrinsics and NVIC access that would be ARM instructions or fixed addresses
+void HostNvicSetPending(IRQn_Type irq);
+#undef NVIC_SetPendingIRQ
+#define NVIC_SetPendingIRQ(irq)	HostNvicSetPending(irq)
+#define __DMB()					__sync_synchronize()
+#define __DSB()					__sync_synchronize()
+#define __ISB()					__sync_synchronize()
+#undef __WFI
+#define __WFI()					((void)0)
+#undef __NOP
+#define __NOP()					((void)0)
+
+extern uint32_t hostNvicPending;		// Bit per IRQn >= 0 set by NVIC_SetPendingIRQ()
+extern void (*hostNvicHook)(IRQn_Type irq);	// Called after the bit is set, a harness can run the handler there
+
+
+#endif // HAL_HOST_H
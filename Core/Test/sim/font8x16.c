@@ -0,0 +1,464 @@
+/**
+  ******************************************************************************
+  * @file    font8x16.c
+  * @brief   8x16 stand-in for the LT7680 internal CGROM, host simulator only
+  ******************************************************************************
+  * 1bpp, 1 byte per row (MSB = leftmost dot), 16 rows per glyph, codes 0x20-0xFF
+  * (ISO 8859-1, 0x7F-0xA0 blank). The 24 and 32 dot CGROM sizes are this font
+  * scaled up, so shapes are not the real CGROM but cell sizes and placement are.
+  * Rasterised from DejaVu Sans Mono at 14 px.
+*/
+
+#include "lt7680_model.h"
+
+
+const uint8_t simFont8x16[SIM_FONT_CODES][16] = {
+    // 0x20
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x21 '!'
+    { 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x22 '"'
+    { 0x00, 0x00, 0x34, 0x34, 0x34, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x23 '#'
+    { 0x00, 0x00, 0x1A, 0x12, 0x12, 0x7F, 0x34, 0x24, 0xFF, 0x2C, 0x68, 0x48, 0x00, 0x00, 0x00, 0x00 },
+    // 0x24 '$'
+    { 0x00, 0x08, 0x08, 0x3C, 0x6A, 0x68, 0x68, 0x3C, 0x0A, 0x0B, 0x4A, 0x3E, 0x08, 0x08, 0x00, 0x00 },
+    // 0x25 '%'
+    { 0x00, 0x00, 0x70, 0xD8, 0xD8, 0x73, 0x0C, 0x30, 0x46, 0x09, 0x09, 0x0F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x26 '&'
+    { 0x00, 0x00, 0x3C, 0x20, 0x20, 0x30, 0x70, 0x59, 0xCD, 0xC7, 0x66, 0x3F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x27
+    { 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x28 '('
+    { 0x00, 0x04, 0x08, 0x08, 0x18, 0x10, 0x10, 0x10, 0x10, 0x18, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00 },
+    // 0x29 ')'
+    { 0x00, 0x10, 0x10, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x10, 0x10, 0x00, 0x00, 0x00 },
+    // 0x2A '*'
+    { 0x00, 0x00, 0x08, 0x6A, 0x3C, 0x3C, 0x6A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x2B '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x2C ','
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x10, 0x00, 0x00 },
+    // 0x2D '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x2E '.'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x2F '/'
+    { 0x00, 0x00, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x18, 0x10, 0x30, 0x20, 0x60, 0x40, 0x00, 0x00 },
+    // 0x30 '0'
+    { 0x00, 0x00, 0x3C, 0x26, 0x62, 0x43, 0x43, 0x5B, 0x43, 0x62, 0x26, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x31 '1'
+    { 0x00, 0x00, 0x18, 0x28, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x32 '2'
+    { 0x00, 0x00, 0x3C, 0x46, 0x02, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x33 '3'
+    { 0x00, 0x00, 0x3C, 0x46, 0x02, 0x06, 0x1C, 0x06, 0x02, 0x02, 0x46, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x34 '4'
+    { 0x00, 0x00, 0x0E, 0x0E, 0x16, 0x36, 0x26, 0x46, 0x7F, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 },
+    // 0x35 '5'
+    { 0x00, 0x00, 0x7E, 0x60, 0x60, 0x7C, 0x46, 0x02, 0x02, 0x02, 0x46, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x36 '6'
+    { 0x00, 0x00, 0x1C, 0x32, 0x60, 0x40, 0x7C, 0x66, 0x63, 0x63, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x37 '7'
+    { 0x00, 0x00, 0x7E, 0x02, 0x06, 0x04, 0x0C, 0x0C, 0x08, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00 },
+    // 0x38 '8'
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x66, 0x3C, 0x66, 0x43, 0x43, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x39 '9'
+    { 0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x67, 0x3F, 0x02, 0x02, 0x06, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x3A ':'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x3B ';'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x10, 0x00, 0x00 },
+    // 0x3C '<'
+    { 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x78, 0xE0, 0x78, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x3D '='
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x3E '>'
+    { 0x00, 0x00, 0x00, 0x00, 0x40, 0x78, 0x0E, 0x03, 0x0E, 0x78, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x3F '?'
+    { 0x00, 0x00, 0x3C, 0x26, 0x02, 0x06, 0x0C, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x40 '@'
+    { 0x00, 0x00, 0x1E, 0x23, 0x41, 0xCF, 0x9B, 0x91, 0x91, 0x9B, 0xCF, 0x40, 0x30, 0x1E, 0x00, 0x00 },
+    // 0x41 'A'
+    { 0x00, 0x00, 0x18, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0x42 'B'
+    { 0x00, 0x00, 0x7C, 0x66, 0x62, 0x66, 0x7C, 0x62, 0x63, 0x63, 0x63, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x43 'C'
+    { 0x00, 0x00, 0x1E, 0x32, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x32, 0x1E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x44 'D'
+    { 0x00, 0x00, 0x7C, 0x46, 0x42, 0x43, 0x43, 0x43, 0x43, 0x42, 0x46, 0x7C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x45 'E'
+    { 0x00, 0x00, 0x7F, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x46 'F'
+    { 0x00, 0x00, 0x7F, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },
+    // 0x47 'G'
+    { 0x00, 0x00, 0x1E, 0x32, 0x60, 0x40, 0x40, 0x47, 0x43, 0x63, 0x33, 0x1E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x48 'H'
+    { 0x00, 0x00, 0x43, 0x43, 0x43, 0x43, 0x7F, 0x43, 0x43, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00 },
+    // 0x49 'I'
+    { 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x4A 'J'
+    { 0x00, 0x00, 0x3E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x4C, 0x78, 0x00, 0x00, 0x00, 0x00 },
+    // 0x4B 'K'
+    { 0x00, 0x00, 0x43, 0x46, 0x4C, 0x58, 0x78, 0x68, 0x4C, 0x46, 0x42, 0x43, 0x00, 0x00, 0x00, 0x00 },
+    // 0x4C 'L'
+    { 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x4D 'M'
+    { 0x00, 0x00, 0xE3, 0xE7, 0xE7, 0xD7, 0xDB, 0xDB, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00 },
+    // 0x4E 'N'
+    { 0x00, 0x00, 0x63, 0x63, 0x73, 0x53, 0x5B, 0x4B, 0x4F, 0x47, 0x47, 0x47, 0x00, 0x00, 0x00, 0x00 },
+    // 0x4F 'O'
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x50 'P'
+    { 0x00, 0x00, 0x7E, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },
+    // 0x51 'Q'
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x06, 0x02, 0x00, 0x00 },
+    // 0x52 'R'
+    { 0x00, 0x00, 0x7C, 0x46, 0x42, 0x42, 0x46, 0x7C, 0x46, 0x42, 0x43, 0x41, 0x00, 0x00, 0x00, 0x00 },
+    // 0x53 'S'
+    { 0x00, 0x00, 0x3C, 0x62, 0x40, 0x60, 0x38, 0x1E, 0x02, 0x03, 0x46, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x54 'T'
+    { 0x00, 0x00, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x55 'U'
+    { 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x56 'V'
+    { 0x00, 0x00, 0xC3, 0x43, 0x62, 0x62, 0x26, 0x26, 0x34, 0x1C, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x57 'W'
+    { 0x00, 0x00, 0xC1, 0xC1, 0xC1, 0xD9, 0x5B, 0x5F, 0x77, 0x76, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },
+    // 0x58 'X'
+    { 0x00, 0x00, 0x43, 0x62, 0x36, 0x1C, 0x18, 0x1C, 0x34, 0x26, 0x62, 0xC3, 0x00, 0x00, 0x00, 0x00 },
+    // 0x59 'Y'
+    { 0x00, 0x00, 0xC3, 0x62, 0x26, 0x34, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x5A 'Z'
+    { 0x00, 0x00, 0x7F, 0x03, 0x06, 0x04, 0x0C, 0x18, 0x10, 0x30, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x5B '['
+    { 0x00, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x00, 0x00, 0x00 },
+    // 0x5C
+    { 0x00, 0x00, 0x40, 0x60, 0x20, 0x30, 0x10, 0x18, 0x08, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x00, 0x00 },
+    // 0x5D ']'
+    { 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00, 0x00, 0x00 },
+    // 0x5E '^'
+    { 0x00, 0x00, 0x18, 0x3C, 0x26, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x5F '_'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00 },
+    // 0x60 '`'
+    { 0x30, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x61 'a'
+    { 0x00, 0x00, 0x00, 0x00, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0x62 'b'
+    { 0x00, 0x60, 0x60, 0x60, 0x7C, 0x66, 0x63, 0x63, 0x63, 0x63, 0x66, 0x7C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x63 'c'
+    { 0x00, 0x00, 0x00, 0x00, 0x1E, 0x32, 0x60, 0x60, 0x60, 0x60, 0x32, 0x1E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x64 'd'
+    { 0x00, 0x02, 0x02, 0x02, 0x3E, 0x66, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x65 'e'
+    { 0x00, 0x00, 0x00, 0x00, 0x3C, 0x62, 0x43, 0x7F, 0x40, 0x60, 0x62, 0x3E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x66 'f'
+    { 0x00, 0x0E, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x67 'g'
+    { 0x00, 0x00, 0x00, 0x00, 0x3E, 0x66, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3E, 0x02, 0x26, 0x3C, 0x00 },
+    // 0x68 'h'
+    { 0x00, 0x60, 0x60, 0x60, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x00, 0x00, 0x00, 0x00 },
+    // 0x69 'i'
+    { 0x00, 0x08, 0x08, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0x6A 'j'
+    { 0x00, 0x08, 0x08, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00 },
+    // 0x6B 'k'
+    { 0x00, 0x60, 0x60, 0x60, 0x62, 0x64, 0x68, 0x78, 0x6C, 0x66, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00 },
+    // 0x6C 'l'
+    { 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x6D 'm'
+    { 0x00, 0x00, 0x00, 0x00, 0x7E, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x00, 0x00, 0x00, 0x00 },
+    // 0x6E 'n'
+    { 0x00, 0x00, 0x00, 0x00, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x00, 0x00, 0x00, 0x00 },
+    // 0x6F 'o'
+    { 0x00, 0x00, 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x70 'p'
+    { 0x00, 0x00, 0x00, 0x00, 0x7C, 0x66, 0x62, 0x63, 0x63, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x00 },
+    // 0x71 'q'
+    { 0x00, 0x00, 0x00, 0x00, 0x3E, 0x66, 0x62, 0x42, 0x42, 0x62, 0x66, 0x3A, 0x02, 0x02, 0x02, 0x00 },
+    // 0x72 'r'
+    { 0x00, 0x00, 0x00, 0x00, 0x3F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00 },
+    // 0x73 's'
+    { 0x00, 0x00, 0x00, 0x00, 0x3C, 0x22, 0x60, 0x38, 0x0E, 0x02, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0x74 't'
+    { 0x00, 0x00, 0x10, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x75 'u'
+    { 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0x76 'v'
+    { 0x00, 0x00, 0x00, 0x00, 0x43, 0x62, 0x66, 0x26, 0x34, 0x34, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0x77 'w'
+    { 0x00, 0x00, 0x00, 0x00, 0x81, 0xC1, 0xD9, 0x5B, 0x5B, 0x76, 0x76, 0x26, 0x00, 0x00, 0x00, 0x00 },
+    // 0x78 'x'
+    { 0x00, 0x00, 0x00, 0x00, 0x62, 0x26, 0x3C, 0x18, 0x18, 0x34, 0x66, 0x43, 0x00, 0x00, 0x00, 0x00 },
+    // 0x79 'y'
+    { 0x00, 0x00, 0x00, 0x00, 0x43, 0x62, 0x22, 0x26, 0x34, 0x1C, 0x1C, 0x18, 0x18, 0x10, 0x70, 0x00 },
+    // 0x7A 'z'
+    { 0x00, 0x00, 0x00, 0x00, 0x7E, 0x06, 0x04, 0x08, 0x18, 0x30, 0x20, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0x7B '{'
+    { 0x00, 0x0E, 0x08, 0x08, 0x08, 0x18, 0x18, 0x70, 0x18, 0x18, 0x08, 0x08, 0x08, 0x0E, 0x00, 0x00 },
+    // 0x7C '|'
+    { 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 },
+    // 0x7D '}'
+    { 0x00, 0x70, 0x18, 0x18, 0x18, 0x18, 0x08, 0x0E, 0x08, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x00 },
+    // 0x7E '~'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x7F
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x80
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x81
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x82
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x83
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x84
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x85
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x86
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x87
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x88
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x89
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x8A
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x8B
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x8C
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x8D
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x8E
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x8F
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x90
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x91
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x92
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x93
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x94
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x95
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x96
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x97
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x98
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x99
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x9A
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x9B
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x9C
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x9D
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x9E
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0x9F
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xA0
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xA1
+    { 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00 },
+    // 0xA2
+    { 0x00, 0x00, 0x04, 0x04, 0x1E, 0x36, 0x24, 0x64, 0x64, 0x24, 0x36, 0x1E, 0x04, 0x04, 0x00, 0x00 },
+    // 0xA3
+    { 0x00, 0x00, 0x0E, 0x18, 0x10, 0x30, 0x30, 0x7E, 0x30, 0x30, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xA4
+    { 0x00, 0x00, 0x00, 0x00, 0x22, 0x3E, 0x36, 0x22, 0x36, 0x3E, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xA5
+    { 0x00, 0x00, 0x43, 0x62, 0x24, 0x7F, 0x18, 0x7F, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0xA6
+    { 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },
+    // 0xA7
+    { 0x00, 0x00, 0x3E, 0x20, 0x30, 0x38, 0x66, 0x62, 0x32, 0x1C, 0x06, 0x06, 0x3C, 0x00, 0x00, 0x00 },
+    // 0xA8
+    { 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xA9
+    { 0x00, 0x00, 0x00, 0x3C, 0x63, 0xBD, 0xA0, 0xA0, 0xBD, 0x63, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xAA
+    { 0x00, 0x00, 0x3C, 0x04, 0x1E, 0x26, 0x26, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xAB
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x36, 0x6C, 0x6C, 0x36, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xAC
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xAD
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xAE
+    { 0x00, 0x00, 0x00, 0x3C, 0x63, 0xBD, 0xA4, 0xBC, 0xA5, 0x63, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xAF
+    { 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB0
+    { 0x00, 0x00, 0x1C, 0x24, 0x24, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB1
+    { 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB2
+    { 0x00, 0x00, 0x3C, 0x04, 0x04, 0x08, 0x10, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB3
+    { 0x00, 0x00, 0x3C, 0x04, 0x1C, 0x04, 0x04, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB4
+    { 0x04, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB5
+    { 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x7F, 0x60, 0x60, 0x60, 0x00 },
+    // 0xB6
+    { 0x00, 0x00, 0x3E, 0x7A, 0x7A, 0x7A, 0x7A, 0x3A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00 },
+    // 0xB7
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xB8
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x18, 0x00 },
+    // 0xB9
+    { 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xBA
+    { 0x00, 0x00, 0x1C, 0x26, 0x22, 0x22, 0x26, 0x1C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xBB
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x12, 0x12, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xBC
+    { 0x00, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x7F, 0x3C, 0xE6, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x00, 0x00 },
+    // 0xBD
+    { 0x00, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x7F, 0x3C, 0xFE, 0x02, 0x02, 0x04, 0x08, 0x1F, 0x00, 0x00 },
+    // 0xBE
+    { 0x00, 0x70, 0x18, 0x30, 0x18, 0x18, 0x77, 0x3C, 0xE6, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x00, 0x00 },
+    // 0xBF
+    { 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x18, 0x30, 0x20, 0x60, 0x62, 0x3C, 0x00 },
+    // 0xC0
+    { 0x00, 0x00, 0x18, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC1
+    { 0x00, 0x00, 0x18, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC2
+    { 0x00, 0x00, 0x18, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC3
+    { 0x00, 0x00, 0x18, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC4
+    { 0x00, 0x00, 0x18, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x42, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC5
+    { 0x34, 0x34, 0x1C, 0x1C, 0x34, 0x34, 0x26, 0x26, 0x7E, 0x43, 0x43, 0xC1, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC6
+    { 0x00, 0x00, 0x1F, 0x3C, 0x2C, 0x2C, 0x6F, 0x4C, 0x7C, 0x4C, 0xCC, 0x8F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC7
+    { 0x00, 0x00, 0x1E, 0x32, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x32, 0x1E, 0x04, 0x04, 0x1C, 0x00 },
+    // 0xC8
+    { 0x00, 0x00, 0x7F, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xC9
+    { 0x00, 0x00, 0x7F, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xCA
+    { 0x00, 0x00, 0x7F, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xCB
+    { 0x00, 0x00, 0x7F, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xCC
+    { 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xCD
+    { 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xCE
+    { 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xCF
+    { 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD0
+    { 0x00, 0x00, 0x7C, 0x46, 0x42, 0x43, 0xF3, 0x43, 0x43, 0x42, 0x46, 0x7C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD1
+    { 0x00, 0x00, 0x63, 0x63, 0x73, 0x53, 0x5B, 0x4B, 0x4F, 0x47, 0x47, 0x47, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD2
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD3
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD4
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD5
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD6
+    { 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD7
+    { 0x00, 0x00, 0x00, 0x00, 0x42, 0x36, 0x1C, 0x1C, 0x36, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD8
+    { 0x00, 0x00, 0x3D, 0x66, 0x66, 0x47, 0x4B, 0x53, 0x73, 0x62, 0x66, 0xFC, 0x00, 0x00, 0x00, 0x00 },
+    // 0xD9
+    { 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xDA
+    { 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xDB
+    { 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xDC
+    { 0x00, 0x00, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xDD
+    { 0x00, 0x00, 0xC3, 0x62, 0x26, 0x34, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    // 0xDE
+    { 0x00, 0x00, 0x60, 0x7E, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },
+    // 0xDF
+    { 0x00, 0x3C, 0x66, 0x66, 0x6C, 0x68, 0x68, 0x6C, 0x66, 0x63, 0x63, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE0
+    { 0x30, 0x10, 0x08, 0x00, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE1
+    { 0x04, 0x0C, 0x18, 0x00, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE2
+    { 0x00, 0x18, 0x1C, 0x24, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE3
+    { 0x00, 0x36, 0x2C, 0x00, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE4
+    { 0x00, 0x34, 0x00, 0x00, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE5
+    { 0x34, 0x34, 0x1C, 0x00, 0x3C, 0x66, 0x02, 0x3E, 0x62, 0x42, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE6
+    { 0x00, 0x00, 0x00, 0x00, 0x77, 0x19, 0x09, 0x7F, 0xC8, 0xC8, 0xD9, 0x77, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE7
+    { 0x00, 0x00, 0x00, 0x00, 0x1E, 0x32, 0x60, 0x60, 0x60, 0x60, 0x32, 0x1E, 0x04, 0x04, 0x1C, 0x00 },
+    // 0xE8
+    { 0x30, 0x10, 0x08, 0x00, 0x3C, 0x62, 0x43, 0x7F, 0x40, 0x60, 0x62, 0x3E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xE9
+    { 0x04, 0x0C, 0x08, 0x00, 0x3C, 0x62, 0x43, 0x7F, 0x40, 0x60, 0x62, 0x3E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xEA
+    { 0x00, 0x18, 0x1C, 0x34, 0x3C, 0x62, 0x43, 0x7F, 0x40, 0x60, 0x62, 0x3E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xEB
+    { 0x00, 0x34, 0x00, 0x00, 0x3C, 0x62, 0x43, 0x7F, 0x40, 0x60, 0x62, 0x3E, 0x00, 0x00, 0x00, 0x00 },
+    // 0xEC
+    { 0x30, 0x10, 0x08, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xED
+    { 0x04, 0x0C, 0x18, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xEE
+    { 0x00, 0x18, 0x1C, 0x24, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xEF
+    { 0x00, 0x36, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF0
+    { 0x00, 0x30, 0x38, 0x0C, 0x3E, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF1
+    { 0x00, 0x36, 0x2C, 0x00, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF2
+    { 0x30, 0x10, 0x08, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF3
+    { 0x04, 0x0C, 0x18, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF4
+    { 0x00, 0x18, 0x1C, 0x24, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF5
+    { 0x00, 0x36, 0x2C, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF6
+    { 0x00, 0x34, 0x00, 0x00, 0x3C, 0x66, 0x62, 0x43, 0x43, 0x62, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF7
+    { 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0xFF, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF8
+    { 0x00, 0x00, 0x00, 0x00, 0x3F, 0x66, 0x66, 0x4B, 0x53, 0x72, 0x66, 0x7C, 0x00, 0x00, 0x00, 0x00 },
+    // 0xF9
+    { 0x30, 0x10, 0x08, 0x00, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xFA
+    { 0x04, 0x0C, 0x18, 0x00, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xFB
+    { 0x00, 0x18, 0x1C, 0x24, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xFC
+    { 0x00, 0x34, 0x00, 0x00, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66, 0x3A, 0x00, 0x00, 0x00, 0x00 },
+    // 0xFD
+    { 0x04, 0x0C, 0x18, 0x00, 0x43, 0x62, 0x22, 0x26, 0x34, 0x1C, 0x1C, 0x18, 0x18, 0x10, 0x70, 0x00 },
+    // 0xFE
+    { 0x00, 0x60, 0x60, 0x60, 0x7C, 0x66, 0x62, 0x63, 0x63, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x00 },
+    // 0xFF
+    { 0x00, 0x34, 0x00, 0x00, 0x43, 0x62, 0x22, 0x26, 0x34, 0x1C, 0x1C, 0x18, 0x18, 0x10, 0x70, 0x00 },
+};
@@ -0,0 +1,531 @@
+/**
+  ******************************************************************************
+  * @file    lt7680_model.c
+  * @brief   Host model of the LT7680 - SPI control byte decode, registers,
+  *          SDRAM and the engines lt7680.c uses, see lt7680_model.h
+  ******************************************************************************
+  * Control bytes as lt7680.c sends them: 00h register select, 80h data write,
+  * 40h status read, C0h data read. After 80h with the memory data port (04h)
+  * selected every byte up to CS high is data, otherwise control + data pairs
+  * may repeat inside one CS (LT7680_XFER_BURST).
+  * Engines finish at once, so STSR always reads write FIFO empty and core idle,
+  * and the Vsync flag (INTF bit 4) is set again by the time it is read.
+  * Only what the firmware drives is modelled: canvas and BTE at 16bpp, linear
+  * 8bpp memory writes (CGRAM upload), text in CGROM or CGRAM, lines, squares.
+  * Anything else counts in simStats.errors rather than being guessed at.
+*/
+
+#include "lt7680_model.h"
+#include "lt7680.h"
+
+#include <stdio.h>
+#include <string.h>
+
+SIM_Stats simStats;
+const char* simLastError = "";
+uint8_t simRegs[256];
+
+static uint8_t simSdram[SIM_SDRAM_SIZE];
+
+typedef enum {
+    SIM_CONTROL,        // Next byte is a control byte
+    SIM_SELECT,         // Register address
+    SIM_WRITE,          // One data byte for the selected register
+    SIM_STREAM,         // Memory data port, data until CS high
+    SIM_STATUS,         // Reply clocked out: STSR
+    SIM_READ,           // Reply clocked out: selected register
+    SIM_DISCARD         // Bad control byte, rest of the transaction ignored
+} SIM_State;
+
+static SIM_State simState = SIM_CONTROL;
+static uint8_t simCs = 0;               // 1 = CS low
+static uint8_t simSelected = 0;
+static uint8_t simPixelLow;             // First byte of a 16bpp pixel from the memory port
+static uint8_t simPixelHalf = 0;
+
+// PIP1/PIP2 parameters, 2Ah-3Bh go to the one MPWCTR bit 4 selects
+static uint8_t simPip[2][0x3C - 0x2A];
+
+
+static void SIM_Error(const char* what)
+{
+    simStats.errors++;
+    simLastError = what;
+}
+
+void SIM_Reset(void)
+{
+    memset(&simStats, 0, sizeof(simStats));
+    memset(simRegs, 0, sizeof(simRegs));
+    memset(simPip, 0, sizeof(simPip));
+    simLastError = "";
+    simState = SIM_CONTROL;
+    simCs = 0;
+    simPixelHalf = 0;
+}
+
+
+//**************************************************************************************************
+// Register fields
+
+static uint32_t Reg32(uint8_t reg)
+{
+    return simRegs[reg] | (simRegs[reg + 1] << 8) | ((uint32_t)simRegs[reg + 2] << 16) | ((uint32_t)simRegs[reg + 3] << 24);
+}
+
+static uint16_t Reg13(uint8_t reg)
+{
+    return (uint16_t)(simRegs[reg] | ((simRegs[reg + 1] & 0x1F) << 8));
+}
+
+static void SetReg13(uint8_t reg, uint16_t v)
+{
+    simRegs[reg] = v & 0xFF;
+    simRegs[reg + 1] = (v >> 8) & 0x1F;
+}
+
+static uint16_t Rgb565(uint8_t reg)
+{
+    return (uint16_t)(((simRegs[reg] & 0xF8) << 8) | ((simRegs[reg + 1] & 0xFC) << 3) | (simRegs[reg + 2] >> 3));
+}
+
+static uint16_t PipReg13(int pip, uint8_t reg)
+{
+    return (uint16_t)(simPip[pip][reg - 0x2A] | ((simPip[pip][reg - 0x2A + 1] & 0x1F) << 8));
+}
+
+static uint32_t PipReg32(int pip, uint8_t reg)
+{
+    const uint8_t* p = &simPip[pip][reg - 0x2A];
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+//**************************************************************************************************
+// SDRAM, 16bpp images are RGB565 little endian
+
+static void SdramWrite16(uint32_t address, uint16_t pixel)
+{
+    if (address + 1 >= SIM_SDRAM_SIZE) {
+        SIM_Error("SDRAM write out of range");
+        return;
+    }
+    simSdram[address] = pixel & 0xFF;
+    simSdram[address + 1] = pixel >> 8;
+    simStats.pixels++;
+}
+
+uint16_t SIM_ImagePixel(uint32_t address, uint16_t width, uint16_t x, uint16_t y)
+{
+    uint32_t a = address + ((uint32_t)y * width + x) * 2;
+
+    if (a + 1 >= SIM_SDRAM_SIZE) return 0;
+    return (uint16_t)(simSdram[a] | (simSdram[a + 1] << 8));
+}
+
+// Pixel on the canvas (CVSSA 50h-53h, CVS_IMWTH 54h-55h), clipped to the active window (56h-5Dh)
+static void CanvasPixel(uint16_t x, uint16_t y, uint16_t pixel)
+{
+    uint16_t awx = Reg13(0x56), awy = Reg13(0x58);
+
+    if (x < awx || y < awy || x >= awx + Reg13(0x5A) || y >= awy + Reg13(0x5C)) return;
+
+    uint16_t width = (uint16_t)(simRegs[0x54] | ((simRegs[0x55] & 0x3F) << 8));
+    SdramWrite16(Reg32(0x50) + ((uint32_t)y * width + x) * 2, pixel);
+}
+
+
+//**************************************************************************************************
+// Text engine - CCR0 CCh, CCR1 CDh, line gap D0h, spacing D1h, cursor 63h-66h, colours D2h-D7h
+
+static uint8_t GlyphDot(uint8_t code, uint8_t source, uint16_t w, uint16_t h, uint16_t gx, uint16_t gy)
+{
+    if (source == 0) {          // CGROM, the 8x16 font scaled to the size
+        if (code < SIM_FONT_FIRST) return 0;
+        return (simFont8x16[code - SIM_FONT_FIRST][gy * 16 / h] >> (7 - gx * 8 / w)) & 1;
+    }
+
+    // CGRAM (DBh-DEh), 1bpp rows MSB first, whole bytes per row
+    uint16_t rowBytes = (uint16_t)((w + 7) / 8);
+    uint32_t a = Reg32(0xDB) + (uint32_t)code * rowBytes * h + (uint32_t)gy * rowBytes + gx / 8;
+
+    if (a >= SIM_SDRAM_SIZE) return 0;
+    return (simSdram[a] >> (7 - gx % 8)) & 1;
+}
+
+static void TextEngine(uint8_t code)
+{
+    uint8_t ccr0 = simRegs[0xCC], ccr1 = simRegs[0xCD];
+    uint8_t source = ccr0 >> 6;
+    uint16_t h = (uint16_t)(16 + 8 * ((ccr0 >> 4) & 3));       // 16/24/32 dots, half width characters
+    uint16_t w = h / 2;
+    uint8_t rotate = (ccr1 >> 4) & 1;
+    uint8_t transparent = (ccr1 >> 6) & 1;                      // Chroma keying, background not drawn
+    uint16_t cellW = (uint16_t)(w * (((ccr1 >> 2) & 3) + 1));   // Along the text direction
+    uint16_t cellH = (uint16_t)(h * ((ccr1 & 3) + 1));
+    uint16_t fg = Rgb565(0xD2), bg = Rgb565(0xD5);
+    uint16_t cx = Reg13(0x63), cy = Reg13(0x65);
+
+    if (source == 0b01 || source == 0b11 || h > 32) {
+        SIM_Error("text: font source or size not modelled");
+        return;
+    }
+
+    // Cursor along X, or along Y when rotated, next line once the cell would leave the active window
+    if (!rotate && cx + cellW > Reg13(0x56) + Reg13(0x5A)) {
+        cx = Reg13(0x56);
+        cy = (uint16_t)(cy + cellH + (simRegs[0xD0] & 0x1F));
+    }
+    else if (rotate && cy + cellW > Reg13(0x58) + Reg13(0x5C)) {
+        cy = Reg13(0x58);
+        cx = (uint16_t)(cx + cellH + (simRegs[0xD0] & 0x1F));
+    }
+
+    for (uint16_t v = 0; v < cellH; v++) {
+        for (uint16_t u = 0; u < cellW; u++) {
+            uint8_t dot = GlyphDot(code, source, w, h, (uint16_t)(u * w / cellW), (uint16_t)(v * h / cellH));
+
+            if (!dot && transparent) continue;
+            // Rotated is 90 degrees counterclockwise + horizontal flip: glyph rows become canvas columns
+            if (rotate) CanvasPixel((uint16_t)(cx + v), (uint16_t)(cy + u), dot ? fg : bg);
+            else CanvasPixel((uint16_t)(cx + u), (uint16_t)(cy + v), dot ? fg : bg);
+        }
+    }
+
+    uint16_t advance = (uint16_t)(cellW + (simRegs[0xD1] & 0x3F));
+    if (rotate) cy = (uint16_t)(cy + advance);
+    else cx = (uint16_t)(cx + advance);
+    SetReg13(0x63, cx);
+    SetReg13(0x65, cy);
+    simStats.chars++;
+}
+
+
+//**************************************************************************************************
+// Memory data port (04h) in graphic mode - linear (AW_COLOR bit 2) or block at the graphic cursor 5Fh-62h
+
+static void MemoryWrite(uint8_t data)
+{
+    uint8_t awColor = simRegs[0x5E];
+
+    if (simRegs[0x03] & 0x03) {
+        SIM_Error("memory port: only the SDRAM image buffer is modelled");
+        return;
+    }
+
+    if (awColor & 0x04) {
+        uint32_t a = Reg32(0x5F);
+
+        if ((awColor & 0x03) != 0) {
+            SIM_Error("memory port: linear writes only modelled at 8bpp");
+            return;
+        }
+        if (a < SIM_SDRAM_SIZE) simSdram[a] = data;
+        else SIM_Error("SDRAM write out of range");
+        a++;
+        simRegs[0x5F] = a & 0xFF;
+        simRegs[0x60] = (a >> 8) & 0xFF;
+        simRegs[0x61] = (a >> 16) & 0xFF;
+        simRegs[0x62] = (a >> 24) & 0xFF;
+        return;
+    }
+
+    if ((awColor & 0x03) != 0x01) {
+        SIM_Error("memory port: block writes only modelled at 16bpp");
+        return;
+    }
+
+    // Low byte first, X runs to the active window edge then wraps to the next line
+    if (!simPixelHalf) {
+        simPixelLow = data;
+        simPixelHalf = 1;
+        return;
+    }
+    simPixelHalf = 0;
+
+    uint16_t x = Reg13(0x5F), y = Reg13(0x61);
+    CanvasPixel(x, y, (uint16_t)(simPixelLow | (data << 8)));
+    if (++x >= Reg13(0x56) + Reg13(0x5A)) {
+        x = Reg13(0x56);
+        y++;
+    }
+    SetReg13(0x5F, x);
+    SetReg13(0x61, y);
+}
+
+
+//**************************************************************************************************
+// Draw engine - line (67h) and square (76h) from 68h-6Fh in the foreground colour
+
+static void LineEngine(void)
+{
+    int x0 = Reg13(0x68), y0 = Reg13(0x6A), x1 = Reg13(0x6C), y1 = Reg13(0x6E);
+    int dx = (x1 > x0) ? x1 - x0 : x0 - x1, sx = (x0 < x1) ? 1 : -1;
+    int dy = (y1 > y0) ? y0 - y1 : y1 - y0, sy = (y0 < y1) ? 1 : -1;
+    int e = dx + dy;
+    uint16_t fg = Rgb565(0xD2);
+
+    for (;;) {
+        CanvasPixel((uint16_t)x0, (uint16_t)y0, fg);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * e;
+        if (e2 >= dy) { e += dy; x0 += sx; }
+        if (e2 <= dx) { e += dx; y0 += sy; }
+    }
+    simStats.draws++;
+}
+
+static void SquareEngine(uint8_t fill)
+{
+    uint16_t x0 = Reg13(0x68), y0 = Reg13(0x6A), x1 = Reg13(0x6C), y1 = Reg13(0x6E);
+    uint16_t fg = Rgb565(0xD2);
+
+    if (x0 > x1) { uint16_t t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { uint16_t t = y0; y0 = y1; y1 = t; }
+
+    for (uint16_t y = y0; y <= y1; y++) {
+        for (uint16_t x = x0; x <= x1; x++) {
+            if (fill || x == x0 || x == x1 || y == y0 || y == y1) CanvasPixel(x, y, fg);
+        }
+    }
+    simStats.draws++;
+}
+
+
+//**************************************************************************************************
+// BTE (90h) - solid fill and memory copy with ROP, all 16bpp, not clipped to the active window
+
+static uint16_t Rop(uint8_t rop, uint16_t s, uint16_t d)
+{
+    uint16_t r = 0;
+
+    if (rop & 8) r |= s & d;
+    if (rop & 4) r |= s & ~d;
+    if (rop & 2) r |= ~s & d;
+    if (rop & 1) r |= ~s & ~d;
+    return r;
+}
+
+static void BteEngine(void)
+{
+    uint8_t op = simRegs[0x91] & 0x0F, rop = simRegs[0x91] >> 4;
+    uint32_t dAddr = Reg32(0xA7), sAddr = Reg32(0x93);
+    uint16_t dWidth = Reg13(0xAB), dx = Reg13(0xAD), dy = Reg13(0xAF);
+    uint16_t sWidth = Reg13(0x97), sx = Reg13(0x99), sy = Reg13(0x9B);
+    uint16_t w = Reg13(0xB1), h = Reg13(0xB3);
+    uint16_t fg = Rgb565(0xD2);
+
+    if ((simRegs[0x92] & 0x63) != 0x21) {
+        SIM_Error("BTE: only 16bpp S0 and destination modelled");
+        return;
+    }
+    if (op != 0x0C && op != 0x02) {
+        SIM_Error("BTE: operation not modelled");
+        return;
+    }
+
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            uint32_t d = dAddr + ((uint32_t)(dy + y) * dWidth + dx + x) * 2;
+
+            if (op == 0x0C) {
+                SdramWrite16(d, fg);
+            }
+            else {
+                uint16_t s = SIM_ImagePixel(sAddr, sWidth, (uint16_t)(sx + x), (uint16_t)(sy + y));
+                uint16_t old = (d + 1 < SIM_SDRAM_SIZE) ? (uint16_t)(simSdram[d] | (simSdram[d + 1] << 8)) : 0;
+                SdramWrite16(d, Rop(rop, s, old));
+            }
+        }
+    }
+    simStats.btes++;
+}
+
+
+//**************************************************************************************************
+// Register file
+
+static void RegWrite(uint8_t reg, uint8_t v)
+{
+    if (reg >= 0x2A && reg <= 0x3B) {
+        simPip[(simRegs[0x10] >> 4) & 1][reg - 0x2A] = v;
+        return;
+    }
+
+    switch (reg) {
+    case 0x00:                              // SRR - bit 0 software reset
+        if (v & 0x01) memset(simRegs, 0, sizeof(simRegs));
+        return;
+
+    case 0x0C:                              // INTF - write 1 to clear
+        simRegs[0x0C] &= (uint8_t)~v;
+        return;
+
+    case 0x67:                              // DCR0 - bit 7 start, bit 1 triangle
+        simRegs[reg] = v & 0x7F;
+        if (v & 0x80) {
+            if (v & 0x02) SIM_Error("draw: triangle not modelled");
+            else LineEngine();
+        }
+        return;
+
+    case 0x76:                              // DCR1 - bit 7 start, bit 6 fill, bits 5-4 shape
+        simRegs[reg] = v & 0x7F;
+        if (v & 0x80) {
+            if (((v >> 4) & 3) == 0b10) SquareEngine((v >> 6) & 1);
+            else SIM_Error("draw: ellipse and curve shapes not modelled");
+        }
+        return;
+
+    case 0x90:                              // BTE_CTRL0 - bit 4 start
+        simRegs[reg] = v & (uint8_t)~0x10;
+        if (v & 0x10) BteEngine();
+        return;
+
+    default:
+        simRegs[reg] = v;
+        return;
+    }
+}
+
+static uint8_t RegRead(uint8_t reg)
+{
+    if (reg >= 0x2A && reg <= 0x3B) return simPip[(simRegs[0x10] >> 4) & 1][reg - 0x2A];
+
+    switch (reg) {
+    case 0x0C:                              // INTF - a Vsync has always passed by the time it is read
+        simRegs[0x0C] |= 0x10;
+        return simRegs[0x0C];
+    case 0xE4:                              // SDRAM control - bit 0 ready
+        return simRegs[0xE4] | 0x01;
+    default:
+        return simRegs[reg];
+    }
+}
+
+
+//**************************************************************************************************
+// SPI
+
+void SIM_CsLow(void)
+{
+    if (simCs) SIM_Error("CS low while already low");
+    simCs = 1;
+    simState = SIM_CONTROL;
+    simStats.xfers++;
+}
+
+void SIM_CsHigh(void)
+{
+    if (!simCs) return;
+    if (simState == SIM_SELECT || simState == SIM_WRITE || simState == SIM_STATUS || simState == SIM_READ) {
+        SIM_Error("CS high after a control byte with nothing behind it");
+    }
+    if (simState == SIM_STREAM && simPixelHalf) SIM_Error("memory port: odd byte count at 16bpp");
+    simPixelHalf = 0;
+    simCs = 0;
+    simState = SIM_CONTROL;
+}
+
+uint8_t SIM_Byte(uint8_t mosi, uint32_t spiHz)
+{
+    uint8_t miso = 0x00;
+
+    simStats.bytes++;
+    simStats.busNs += spiHz ? 8000000000ull / spiHz : 0;
+
+    if (!simCs) {
+        SIM_Error("SPI byte with CS high");
+        return miso;
+    }
+
+    switch (simState) {
+    case SIM_CONTROL:
+        switch (mosi) {
+        case 0x00: simState = SIM_SELECT; break;
+        case 0x80: simState = (simSelected == 0x04) ? SIM_STREAM : SIM_WRITE; break;
+        case 0x40: simState = SIM_STATUS; break;
+        case 0xC0: simState = SIM_READ; break;
+        default:
+            SIM_Error("bad control byte");
+            simState = SIM_DISCARD;
+            break;
+        }
+        break;
+
+    case SIM_SELECT:
+        simSelected = mosi;
+        simState = SIM_CONTROL;
+        break;
+
+    case SIM_WRITE:
+        RegWrite(simSelected, mosi);
+        simState = SIM_CONTROL;
+        break;
+
+    case SIM_STREAM:
+        if (simRegs[0x03] & 0x04) TextEngine(mosi);
+        else MemoryWrite(mosi);
+        break;
+
+    case SIM_STATUS:                        // STSR - write FIFO empty, read FIFO empty, SDRAM ready, core idle
+        miso = LT7680_STSR_WR_FIFO_EMPTY | 0x10 | 0x04;
+        simStats.reads++;
+        simState = SIM_CONTROL;
+        break;
+
+    case SIM_READ:
+        miso = RegRead(simSelected);
+        simStats.reads++;
+        simState = SIM_CONTROL;
+        break;
+
+    case SIM_DISCARD:
+        break;
+    }
+
+    return miso;
+}
+
+
+//**************************************************************************************************
+// Panel - main window from MISA (20h-23h, width 24h-25h, origin 26h-29h), PIP2 then PIP1 over it
+
+uint16_t SIM_PanelPixel(uint16_t x, uint16_t y)
+{
+    uint8_t mpwctr = simRegs[0x10];
+
+    for (int pip = 1; pip >= 0; pip--) {
+        if (!(mpwctr & (pip ? 0x40 : 0x80))) continue;
+
+        uint16_t wx = PipReg13(pip, 0x2A), wy = PipReg13(pip, 0x2C);
+        if (x < wx || y < wy || x >= wx + PipReg13(pip, 0x38) || y >= wy + PipReg13(pip, 0x3A)) continue;
+
+        return SIM_ImagePixel(PipReg32(pip, 0x2E), PipReg13(pip, 0x32),
+                              (uint16_t)(PipReg13(pip, 0x34) + x - wx), (uint16_t)(PipReg13(pip, 0x36) + y - wy));
+    }
+
+    return SIM_ImagePixel(Reg32(0x20), Reg13(0x24), (uint16_t)(Reg13(0x26) + x), (uint16_t)(Reg13(0x28) + y));
+}
+
+int SIM_WritePpm(const char* path)
+{
+    FILE* f = fopen(path, "wb");
+
+    if (f == NULL) return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", LCD_XSIZE_TFT, LCD_YSIZE_TFT);
+    for (uint16_t y = 0; y < LCD_YSIZE_TFT; y++) {
+        for (uint16_t x = 0; x < LCD_XSIZE_TFT; x++) {
+            uint16_t p = SIM_PanelPixel(x, y);
+            uint8_t rgb[3] = {
+                (uint8_t)(((p >> 11) & 0x1F) * 255 / 31),
+                (uint8_t)(((p >> 5) & 0x3F) * 255 / 63),
+                (uint8_t)((p & 0x1F) * 255 / 31),
+            };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+
+    return fclose(f) == 0 ? 0 : -1;
+}
@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file    lt7680_model.h
+  * @brief   Host model of the LT7680 as display.c/lt7680.c drive it, see
+  *          lt7680_model.c and Core/Test/Makefile (make sim)
+  ******************************************************************************
+  * Bytes go in as the SPI1 wire carries them, one CS low period at a time.
+  * The model decodes the control bytes, keeps the register file and an SDRAM
+  * image, runs the text, draw and BTE engines the firmware uses and composes
+  * the panel (MISA main image + PIP windows) for a PPM dump.
+*/
+
+#ifndef LT7680_MODEL_H
+#define LT7680_MODEL_H
+
+#include <stdint.h>
+
+#define SIM_SDRAM_SIZE			0x00800000	// Bytes, 64Mbit
+#define SIM_FONT_FIRST			0x20		// First code in simFont8x16[]
+#define SIM_FONT_CODES			(0x100 - SIM_FONT_FIRST)
+
+// Wire and engine counters, all cumulative since SIM_Reset()
+typedef struct {
+	uint32_t bytes;				// SPI bytes clocked, control + payload + read replies
+	uint32_t xfers;				// CS low periods
+	uint32_t reads;				// Status and register reads
+	uint64_t busNs;				// Bytes x 8 at the SPI clock each byte went out at
+	uint32_t chars;				// Characters drawn by the text engine
+	uint32_t draws;				// Line and rectangle engine runs
+	uint32_t btes;				// BTE runs
+	uint32_t pixels;			// SDRAM pixels written by the engines and the memory port
+	uint32_t errors;			// Anything the model does not expect, last one in simLastError
+} SIM_Stats;
+
+extern SIM_Stats simStats;
+extern const char* simLastError;
+extern uint8_t simRegs[256];
+extern const uint8_t simFont8x16[SIM_FONT_CODES][16];
+
+void SIM_Reset(void);
+void SIM_CsLow(void);
+void SIM_CsHigh(void);
+uint8_t SIM_Byte(uint8_t mosi, uint32_t spiHz);		// One byte each way, returns MISO
+
+uint16_t SIM_ImagePixel(uint32_t address, uint16_t width, uint16_t x, uint16_t y);	// RGB565 from a 16bpp image
+uint16_t SIM_PanelPixel(uint16_t x, uint16_t y);	// What the panel shows, main image and PIP windows
+int SIM_WritePpm(const char* path);					// Panel as binary PPM, 0 = written
+
+// sim_spi.c - SPI1 and its DMA IRQ in front of the model
+void SIM_SpiInit(void);
+void SIM_SyncCs(void);								// Take CS edges written since the last SPI call
+
+
+#endif // LT7680_MODEL_H
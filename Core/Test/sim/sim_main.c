@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file    sim_main.c
+  * @brief   Host simulator of the display path - display.c and lt7680.c as
+  *          built for the target, SPI1 into the LT7680 model (lt7680_model.c)
+  ******************************************************************************
+  * Boots the LT7680 as main() does, then renders a few 3457A frames through the
+  * render loop steps (LT7680_PageBegin, DisplayMain, DisplayAnnunciators,
+  * LT7680_PageFlip). Per call it prints what went over the wire, SPI bytes, CS
+  * transactions and bus time at the SPI1 clock in use, next to the firmware's
+  * own LT7680_RenderProfile figures, and writes the panel as a 240x960 PPM
+  * (the framebuffer as scanned, the text runs along Y, transpose it to read).
+  * Fails (exit 1) if the model saw anything it did not expect, the firmware
+  * counters disagree with the wire, the pages differ after LT7680_PageBegin(),
+  * or a MAIN cell / annunciator label is not drawn as the frame says.
+  *   build/lt7680_sim [frame.ppm]
+*/
+
+#include "lt7680_model.h"
+#include "lt7680.h"
+#include "display.h"
+#include "timer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+extern uint32_t MainColourFore, AnnunColourFore, BackgroundColour;
+extern volatile LT7680_RenderProfile displayProfMain, displayProfAnnunc;
+
+// What timer.c and main.c provide to display.c
+volatile char displayWithPunct[32];
+volatile uint32_t dbg_loop_per_sec;
+
+static DMM_Frame simFrame;
+
+uint32_t DMM_FrameGeneration(void) { return simFrame.seq; }
+void DMM_FrameSnapshot(DMM_Frame* out) { *out = simFrame; }
+
+
+//***********************************************************************************
+// Frames, annunciators by DisplayAnnunciators() name index
+
+enum { SMPL, REM, SRQ, ADRS, ACDC, WOHM4, AZOFF, MRNG, MATH, REAR, ERR, SHIFT };
+
+static const char* const annuncNames[12] = {
+    "SMPL", "REM", "SRQ", "ADRS", "AC+DC", "4Wohm", "AZOFF", "MRNG", "MATH", "REAR", "ERR", "SHIFT"
+};
+static const int annuncY[12] = { 10, 87, 151, 212, 289, 382, 477, 571, 649, 726, 803, 860 };
+
+typedef struct {
+    const char* text;           // displayWithPunct, 13 characters
+    uint16_t annunc;            // Bit per name index
+    const char* shown;          // MAIN line after ShiftUnitsRight()/FixUnitText(), 14 characters
+} SIM_Reading;
+
+static const SIM_Reading readings[] = {
+    { "  1.23456 VDC", (1u << SMPL) | (1u << REM),  "  1.23456  VDC" },
+    { "  1.23457 VDC", (1u << SMPL) | (1u << AZOFF), "  1.23457  VDC" },
+    { "  1.23457 VDC", (1u << SMPL) | (1u << AZOFF), "  1.23457  VDC" },     // new frame, same content
+    { " 10.21000KOHM", (1u << SMPL) | (1u << WOHM4), " 10.21000 kohm" },
+    { "  -0.1234UADC", (1u << MATH) | (1u << ERR) | (1u << SHIFT), "  -0.1234 \xB5""ADC" },
+};
+
+static int failures = 0;
+
+
+static void Fail(const char* what, int n)
+{
+    printf("FAIL %s (%d)\n", what, n);
+    failures++;
+}
+
+static uint16_t Rgb565(uint32_t rgb)
+{
+    return (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+}
+
+// Panel pixels equal to 'colour' in a block
+static uint32_t CountColour(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t colour)
+{
+    uint32_t n = 0;
+
+    for (uint16_t v = y; v < y + h; v++) {
+        for (uint16_t u = x; u < x + w; u++) {
+            if (SIM_PanelPixel(u, v) == colour) n++;
+        }
+    }
+    return n;
+}
+
+
+//***********************************************************************************
+// Per call cost, wire (model) against firmware (LT7680_RenderProfile)
+
+static void Measure(const char* name, void (*call)(void), volatile LT7680_RenderProfile* prof)
+{
+    uint32_t calls0 = prof ? prof->calls : 0;
+
+    SIM_SyncCs();
+    SIM_Stats s0 = simStats;
+    call();
+    SIM_SyncCs();
+
+    uint32_t bytes = simStats.bytes - s0.bytes;
+    uint32_t xfers = simStats.xfers - s0.xfers;
+    double busUs = (double)(simStats.busNs - s0.busNs) / 1000.0;
+
+    printf("  %-22s %7u %6u %9.1f %6u %6u %6u", name, bytes, xfers, busUs,
+           simStats.chars - s0.chars, simStats.btes - s0.btes, simStats.draws - s0.draws);
+
+    if (prof == NULL || prof->calls == calls0) {
+        printf("  %7s %6s %6s\n", "-", "-", "-");
+        return;
+    }
+    printf("  %7u %6u %6u\n", prof->lastBytes, prof->lastXfers, prof->lastBusUs);
+    if (prof->lastBytes != bytes || prof->lastXfers != xfers) Fail("firmware profile differs from the wire", (int)bytes);
+}
+
+static void Header(const char* title)
+{
+    printf("%s\n  %-22s %7s %6s %9s %6s %6s %6s  %7s %6s %6s\n", title,
+           "call", "bytes", "CS", "bus us", "chars", "BTE", "draw", "fw B", "fw CS", "fw us");
+}
+
+
+//***********************************************************************************
+// Boot, as main() after the LT7680 reset: only the LT7680 side, no backlight PWM or speed test
+
+static void BootDrawLines(void)
+{
+    for (uint16_t y = 951; y <= 959; y++) DrawLine(0, y, 239, y, 0x00, 0x00, 0x00);
+}
+
+static void Boot(void)
+{
+    HardwareReset();
+    SendAllToLT7680_LT();
+    LT7680_SpiAutoTune();
+
+    Header("boot");
+    Measure("ClearScreen", ClearScreen, &lt7680ProfClearScreen);
+    Measure("DrawLine x9", BootDrawLines, NULL);
+    Measure("ClearScreen", ClearScreen, &lt7680ProfClearScreen);
+    Measure("LoadMainFont", LoadMainFont, &lt7680ProfUserFont);
+#if MAIN_GLYPH_ATLAS
+    Measure("BuildMainGlyphAtlas", BuildMainGlyphAtlas, NULL);
+#endif
+    Measure("LT7680_PageInit", LT7680_PageInit, NULL);
+    Measure("InitAnnunciatorLayer", InitAnnunciatorLayer, NULL);
+
+#if LT7680_ASYNC_QUEUE
+    LT7680_QueueEnable(1);
+#endif
+    printf("  SPI1 %u Hz after LT7680_SpiAutoTune()\n", (unsigned)lt7680SpiTune.spiClockHz);
+}
+
+
+//***********************************************************************************
+// Checks on the panel and the pages
+
+// After LT7680_PageBegin() the back page must hold what the front one shows
+static void CheckPages(int n)
+{
+#if LT7680_DISPLAY_PAGES > 1
+    uint32_t back = LT7680_PageBackAddr();
+    uint32_t front = (back == MAIN_IMAGE_START) ? MAIN_IMAGE_START + LT7680_PAGE_SIZE : MAIN_IMAGE_START;
+
+    for (uint16_t y = 0; y < LCD_YSIZE_TFT; y++) {
+        for (uint16_t x = 0; x < LCD_XSIZE_TFT; x++) {
+            if (SIM_ImagePixel(front, LCD_XSIZE_TFT, x, y) != SIM_ImagePixel(back, LCD_XSIZE_TFT, x, y)) {
+                Fail("back page not up to date after LT7680_PageBegin()", n);
+                return;
+            }
+        }
+    }
+#else
+    (void)n;
+#endif
+}
+
+static void CheckPanel(const SIM_Reading* r, int n)
+{
+    uint16_t fore = Rgb565(MainColourFore), annunc = Rgb565(AnnunColourFore), back = Rgb565(BackgroundColour);
+
+    for (int i = 0; i < MAIN_CHARS; i++) {
+        uint32_t lit = CountColour(Xpos_MAIN, (uint16_t)(Ypos_MAIN + i * MAIN_CHAR_PITCH), MAIN_CHAR_HEIGHT, MAIN_CHAR_PITCH, fore);
+
+        if ((r->shown[i] == ' ') != (lit == 0)) Fail("MAIN cell drawn wrong", n * 100 + i);
+    }
+
+    for (int i = 0; i < 12; i++) {
+        uint16_t h = (uint16_t)(strlen(annuncNames[i]) * ANNUNC_CHAR_PITCH);
+        uint32_t lit = CountColour(Xpos_ANNUNC, (uint16_t)annuncY[i], ANNUNC_CHAR_HEIGHT, h, annunc);
+        uint32_t dark = CountColour(Xpos_ANNUNC, (uint16_t)annuncY[i], ANNUNC_CHAR_HEIGHT, h, back);
+
+        if (r->annunc & (1u << i)) {
+            if (lit == 0) Fail("annunciator not lit", n * 100 + i);
+        }
+        else if (dark != (uint32_t)ANNUNC_CHAR_HEIGHT * h) {
+            Fail("annunciator not cleared", n * 100 + i);
+        }
+    }
+}
+
+
+//***********************************************************************************
+
+int main(int argc, char** argv)
+{
+    const char* ppm = (argc > 1) ? argv[1] : "build/frame.ppm";
+
+    SIM_SpiInit();
+    Boot();
+
+    for (int n = 0; n < (int)(sizeof(readings) / sizeof(readings[0])); n++) {
+        const SIM_Reading* r = &readings[n];
+        char title[64];
+
+        simFrame.seq++;
+        memset(simFrame.text, 0, sizeof(simFrame.text));
+        memcpy(simFrame.text, r->text, 13);
+        memset(simFrame.annunc, 0, sizeof(simFrame.annunc));
+        for (int i = 0; i < 12; i++) {
+            if (r->annunc & (1u << i)) simFrame.annunc[12 - i] = 1;
+        }
+
+        snprintf(title, sizeof(title), "frame %d \"%s\"", n + 1, r->text);
+        Header(title);
+        Measure("LT7680_PageBegin", LT7680_PageBegin, NULL);
+        CheckPages(n + 1);
+        Measure("DisplayMain", DisplayMain, &displayProfMain);
+        Measure("DisplayAnnunciators", DisplayAnnunciators, &displayProfAnnunc);
+        Measure("LT7680_PageFlip", LT7680_PageFlip, NULL);
+        CheckPanel(r, n + 1);
+    }
+
+    if (simStats.errors) Fail(simLastError, (int)simStats.errors);
+    if (lt7680WaitTimeouts) Fail("status waits timed out", (int)lt7680WaitTimeouts);
+
+    if (SIM_WritePpm(ppm) != 0) Fail("could not write the PPM", 0);
+    else printf("panel written to %s\n", ppm);
+
+    printf("total: %u bytes, %u CS transactions, %.1f ms on the bus\n",
+           simStats.bytes, simStats.xfers, (double)simStats.busNs / 1e6);
+    printf("lt7680_sim: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file    sim_spi.c
+  * @brief   SPI1, its TX DMA and the DMA1 Channel 3 IRQ for the host simulator,
+  *          every byte lt7680.c sends goes to the LT7680 model
+  ******************************************************************************
+  * CS is PA4 written through BRR/BSRR, by HAL_GPIO_WritePin() (hal_host.c) or
+  * directly (LT7680_CS_LOW/HIGH). Those registers are latched and cleared here
+  * before every SPI call, a BSRR bit ends the transaction, a BRR bit starts one.
+  * A DMA transfer is complete as soon as it is started. The IRQ it pends runs
+  * at once as the target handler does, HAL_SPI_TxCpltCallback() then
+  * LT7680_QueueService(), so queue fences and waits never spin.
+  * Only the HAL driver can be modelled (LT7680_SPI_DRIVER LT7680_DRV_HAL), the
+  * LL one writes SPI1->DR and polls SR itself.
+*/
+
+#include "lt7680_model.h"
+#include "lt7680.h"
+#include "spi.h"
+
+#if LT7680_SPI_DRIVER != LT7680_DRV_HAL
+#error "the simulator needs LT7680_SPI_DRIVER=LT7680_DRV_HAL, see Core/Test/Makefile"
+#endif
+
+static uint8_t simDmaDone = 0;          // TX DMA finished, TC not yet handled
+static uint8_t simInIrq = 0;
+
+
+// Latched CS edges since the last call, rising first: high then low between two calls is a new transaction
+void SIM_SyncCs(void)
+{
+    if (hostGPIOA.BSRR & SPI_CS_PIN) SIM_CsHigh();
+    if (hostGPIOA.BRR & SPI_CS_PIN) SIM_CsLow();
+    hostGPIOA.BSRR = 0;
+    hostGPIOA.BRR = 0;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return SystemCoreClock;             // APB2 undivided, as SystemClock_Config() sets it
+}
+
+static uint32_t SpiHz(void)
+{
+    return HAL_RCC_GetPCLK2Freq() >> (((SPI1->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos) + 1);
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef* hspi)
+{
+    hspi->Instance->CR1 = (hspi->Instance->CR1 & ~SPI_CR1_BR) | (hspi->Init.BaudRatePrescaler & SPI_CR1_BR);
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef* hspi)
+{
+    return hspi->State;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t len, uint32_t timeout)
+{
+    (void)hspi;
+    (void)timeout;
+    SIM_SyncCs();
+    for (uint16_t i = 0; i < len; i++) SIM_Byte(data[i], SpiHz());
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t len, uint32_t timeout)
+{
+    (void)hspi;
+    (void)timeout;
+    SIM_SyncCs();
+    for (uint16_t i = 0; i < len; i++) data[i] = SIM_Byte(0x00, SpiHz());
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t len)
+{
+    HAL_SPI_Transmit(hspi, data, len, 0);
+    simDmaDone = 1;
+    NVIC_SetPendingIRQ(DMA1_Channel3_IRQn);
+    return HAL_OK;
+}
+
+// main.c's callback
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi)
+{
+#if LT7680_ASYNC_QUEUE
+    if (hspi->Instance == SPI1) {
+        LT7680_QueueTxComplete();
+    }
+#else
+    (void)hspi;
+#endif
+}
+
+// DMA1_Channel3_IRQHandler(), run until nothing pends it again. A pend from inside it (the next queued
+// transfer) only sets the bit, the loop here picks it up, so a long queue is not a deep recursion.
+static void SIM_NvicHook(IRQn_Type irq)
+{
+    const uint32_t bit = 1u << DMA1_Channel3_IRQn;
+
+    if (irq != DMA1_Channel3_IRQn || simInIrq) return;
+
+    simInIrq = 1;
+    while (hostNvicPending & bit) {
+        hostNvicPending &= ~bit;
+        if (simDmaDone) {
+            simDmaDone = 0;
+            HAL_SPI_TxCpltCallback(&hspi1);
+        }
+#if LT7680_ASYNC_QUEUE
+        LT7680_QueueService();
+#endif
+    }
+    simInIrq = 0;
+}
+
+// MX_SPI1_Init() at 9MHz, CS high, the LT7680 model reset
+void SIM_SpiInit(void)
+{
+    hspi1.Instance = SPI1;
+    hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
+    HAL_SPI_Init(&hspi1);
+    hostNvicHook = SIM_NvicHook;
+    hostGPIOA.BSRR = 0;
+    hostGPIOA.BRR = 0;
+    SIM_Reset();
+}
@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @file    test_decode12.c
+  * @brief   Host equivalence test and benchmark of HP3457_DecodeFrame() (timer.c)
+  ******************************************************************************
+  * HP3457_DecodeFrame() must give the same code and punctuation as the per-digit
+  * reference HP3457_GetCharCode()/HP3457_GetPunct() for every input. A digit only
+  * depends on one byte of each of regA/regB/regC, so all 2^24 byte triples are
+  * run through every byte position at once (each position gets its own bijective
+  * scramble of the triple, a misplaced byte index still shows).
+  * The benchmark is host time only, it shows the ratio, not target cycles.
+  * Needs DMM_INSTRUMENT >= DMM_INSTR_TRACE (the default) for the reference decode.
+*/
+
+#include "../Src/timer.c"
+
+#include <stdio.h>
+#include <time.h>
+
+#if DMM_INSTRUMENT < DMM_INSTR_TRACE
+#error "test_decode12 needs the reference decode, build with DMM_INSTRUMENT >= DMM_INSTR_TRACE"
+#endif
+
+#define BENCH_FRAMES    2000000
+
+static int failures = 0;
+
+
+// Byte triple v (a | b << 8 | c << 16) as seen by byte position bi
+static void Place(uint32_t v, int bi)
+{
+    uint32_t s = v ^ (0x5A3C96u * (uint32_t)bi);
+
+    regAFrame[bi] = (uint8_t)s;
+    regBFrame[bi] = (uint8_t)(s >> 8);
+    regCFrame[bi] = (uint8_t)(s >> 16);
+}
+
+static void TestExhaustive(void)
+{
+    uint8_t code[12], punct[12];
+    uint32_t mismatches = 0;
+
+    for (uint32_t v = 0; v < (1u << 24); v++) {
+        for (int bi = 0; bi < 6; bi++) Place(v, bi);
+
+        HP3457_DecodeFrame(regAFrame, regBFrame, regCFrame, code, punct);
+
+        for (uint8_t d = 1; d <= 12; d++) {
+            uint8_t refCode = HP3457_GetCharCode(d);
+            uint8_t refPunct = HP3457_GetPunct(d);
+
+            if (code[d - 1] != refCode || punct[d - 1] != refPunct) {
+                if (mismatches++ < 8) {
+                    printf("FAIL v=%06X digit %u: code %02X/%02X punct %u/%u\n",
+                           (unsigned)v, d, code[d - 1], refCode, punct[d - 1], refPunct);
+                }
+            }
+        }
+    }
+
+    printf("exhaustive: %u byte triples x 12 digits, %u mismatches\n", 1u << 24, mismatches);
+    if (mismatches) failures++;
+}
+
+
+//***********************************************************************************
+
+static double Seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+volatile uint8_t benchSink;     // Keeps the decoded codes live
+
+static void Benchmark(void)
+{
+    uint8_t code[12], punct[12];
+    uint32_t seed = 3457;
+    double t0, tFrame, tDigit;
+
+    t0 = Seconds();
+    for (int n = 0; n < BENCH_FRAMES; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        regAFrame[n % 6] = (uint8_t)(seed >> 8);                // one byte changes per frame, defeats hoisting
+        HP3457_DecodeFrame(regAFrame, regBFrame, regCFrame, code, punct);
+        benchSink = code[n % 12] ^ punct[n % 12];
+    }
+    tFrame = Seconds() - t0;
+
+    t0 = Seconds();
+    for (int n = 0; n < BENCH_FRAMES; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        regAFrame[n % 6] = (uint8_t)(seed >> 8);
+        for (uint8_t d = 1; d <= 12; d++) {
+            code[d - 1] = HP3457_GetCharCode(d);
+            punct[d - 1] = HP3457_GetPunct(d);
+        }
+        benchSink = code[n % 12] ^ punct[n % 12];
+    }
+    tDigit = Seconds() - t0;
+
+    printf("benchmark: HP3457_DecodeFrame %.1f ns/frame, per-digit reference %.1f ns/frame (%.1fx, host)\n",
+           tFrame * 1e9 / BENCH_FRAMES, tDigit * 1e9 / BENCH_FRAMES, tDigit / tFrame);
+}
+
+
+int main(void)
+{
+    TestExhaustive();
+    Benchmark();
+
+    printf("test_decode12: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
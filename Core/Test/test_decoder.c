@@ -0,0 +1,287 @@
+/**
+  ******************************************************************************
+  * @file    test_decoder.c
+  * @brief   Host replay of 3457A display bitstreams through the timer.c decoder
+  ******************************************************************************
+  * The same O2 edge samples (GPIOB->IDR values) go through all three decoder
+  * front ends and must give the same frame:
+  *   - DMM_HandleO2Clock(), the per-bit ISR engine, one call per sample
+  *   - DMM_DecodeSamples(), the GPIOB DMA engine's batch decoder, fed with the
+  *     samples in random-sized batches as the ring's half/full interrupts would
+  *   - DMM_DecodeWords(), the word-level stage behind the SPI2 engine, fed with
+  *     the bytes SPI2 would have put in its ring, in random-sized pieces
+  * timer.c is built with the DMA engine selected, the other two decoders are
+  * compiled whatever the engine.
+  * The built-in stream is the frame published with the protocol description
+  * ("Protocol Info/ReadMe.txt": "BEEP,-99999.1_", SMPL and MATH lit), followed
+  * by an annunciator-only update and a repeat. A recorded capture can be
+  * replayed too: test_decoder <file>, one hex IDR sample per line.
+*/
+
+#define DMM_CAPTURE_ENGINE DMM_CAPTURE_DMA      // Brings in DMM_DecodeSamples()
+#include "../Src/timer.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+
+//***********************************************************************************
+// Bitstream generation
+
+typedef struct {
+    uint16_t cmd;               // 10-bit ISA instruction
+    uint8_t  len;               // INA payload bytes
+    uint8_t  data[12];
+    uint8_t  pwo;               // 0 = display not selected (PWO low)
+} Txn;
+
+// As captured in the protocol description, instruction order and register contents unchanged
+static const Txn frameBeep[] = {
+    { 0x3F0, 1,  { 0xFD }, 1 },                                         // select the display
+    { 0x2E0, 1,  { 0x00 }, 1 },
+    { 0x320, 1,  { 0x00 }, 1 },
+    { 0x2F0, 2,  { 0x08, 0x08 }, 1 },                                   // SMPL (bit 11) + MATH (bit 3)
+    { 0x0A8, 6,  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { 0x028, 12, { 0x1F, 0x99, 0x99, 0xD9, 0x50, 0x25 }, 1 },           // 6 more zero bytes follow register A
+    { 0x068, 6,  { 0x31, 0x37, 0x33, 0x23, 0x0D, 0x00 }, 1 },
+    { 0x028, 6,  { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, 0 },           // PWO low: not for the display, must be ignored
+};
+
+// Only the annunciators change: REM alone
+static const Txn frameRem[] = {
+    { 0x3F0, 1,  { 0xFD }, 1 },
+    { 0x2F0, 2,  { 0x00, 0x04 }, 1 },                                   // REM (bit 10)
+};
+
+#define MAX_SAMPLES 8192
+
+static uint16_t samples[MAX_SAMPLES];
+static int sampleCount;
+
+static void Sample(uint16_t idr)
+{
+    if (sampleCount < MAX_SAMPLES) samples[sampleCount++] = idr;
+}
+
+#define IDLE_CLOCKS 8    // O2 keeps running after the payload (INA low), which also completes the last SPI2 byte
+
+// One O2 rising edge per bit: 10 ISA bits with SYNC high, 2 gap clocks, then the payload on INA, all LSB first
+static void Serialize(const Txn* t, int n)
+{
+    for (int k = 0; k < n; k++) {
+        uint16_t pwo = t[k].pwo ? DMM_PWO_Pin : 0;
+
+        for (int b = 0; b < 10; b++) {
+            Sample(pwo | DMM_SYNC_Pin | (((t[k].cmd >> b) & 1u) ? DMM_ISA_Pin : 0));
+        }
+        Sample(pwo);
+        Sample(pwo);
+        for (int i = 0; i < t[k].len; i++) {
+            for (int b = 0; b < 8; b++) {
+                Sample(pwo | (((t[k].data[i] >> b) & 1u) ? DMM_INA_Pin : 0));
+            }
+        }
+        for (int b = 0; b < IDLE_CLOCKS; b++) Sample(pwo);
+    }
+}
+
+
+//***********************************************************************************
+// Decoder harness
+
+static void DecoderReset(void)
+{
+    prevSync = 0;
+    currentTarget = CMD_TGT_NONE;
+    byteShift = 0;
+    byteBitCount = 0;
+    isa10 = 0;
+    isaBitCount = 0;
+    inaGap2 = 0;
+    payloadBytesExpected = 0;
+    payloadBytesGot = 0;
+    memset((void*)regA, 0, 6); memset((void*)regB, 0, 6); memset((void*)regC, 0, 6);
+    memset((void*)regALatched, 0, 6); memset((void*)regBLatched, 0, 6); memset((void*)regCLatched, 0, 6);
+    memset((void*)ann, 0, 2); memset((void*)annLatched, 0, 2);
+    frameLatchSeq = 0;
+    hostSCB.ICSR = 0;
+}
+
+// What PendSV would do on the target
+static void RunPendSV(void)
+{
+    if (hostSCB.ICSR & SCB_ICSR_PENDSVSET_Msk) {
+        hostSCB.ICSR = 0;
+        DMM_FrameBuild();
+    }
+}
+
+// Per-bit engine: one DMM_HandleO2Clock() per sample, as TIM3_IRQHandler
+static void FeedBits(const uint16_t* s, int n)
+{
+    for (int i = 0; i < n; i++) {
+        DMM_HandleO2Clock(s[i]);
+        RunPendSV();
+    }
+}
+
+// GPIOB DMA engine: the IDR snapshots in random-sized batches, as DMM_DmaDrain() hands them over
+static void FeedSamples(const uint16_t* s, int n)
+{
+    int i = 0;
+
+    while (i < n) {
+        int batch = 1 + rand() % 64;
+        if (batch > n - i) batch = n - i;
+        DMM_DecodeSamples(&s[i], (uint16_t)batch);
+        RunPendSV();
+        i += batch;
+    }
+}
+
+// Word engine: pack each SYNC-delimited transaction LSB first as SPI2 does (ISA, gap and INA bits in one count),
+// skip those that started with PWO low (SPI2_TXN_NOPWO) and hand the bytes over in random-sized pieces
+static void FeedWords(const uint16_t* s, int n)
+{
+    int i = 0;
+
+    while (i < n) {
+        if (!(s[i] & DMM_SYNC_Pin)) { i++; continue; }
+
+        uint8_t words[64] = { 0 };
+        int bit = 0;
+        int selected = (s[i] & DMM_PWO_Pin) != 0;
+
+        do {
+            uint8_t level = (s[i] & DMM_SYNC_Pin) ? ((s[i] & DMM_ISA_Pin) != 0) : ((s[i] & DMM_INA_Pin) != 0);
+            if (bit < 8 * (int)sizeof(words)) words[bit / 8] |= (uint8_t)(level << (bit % 8));
+            bit++;
+            i++;
+        } while (i < n && !(!(s[i - 1] & DMM_SYNC_Pin) && (s[i] & DMM_SYNC_Pin)));
+
+        if (!selected) continue;
+
+        uint8_t len = (uint8_t)(bit / 8);
+        if (len > 16) len = 16;                     // DMM_Spi2Drain() copies at most 16
+        uint8_t avail = 0, pos = 0;
+        while (avail < len) {
+            avail = (uint8_t)(avail + 1 + rand() % 4);
+            if (avail > len) avail = len;
+            pos = DMM_DecodeWords(words, avail, pos);
+        }
+        RunPendSV();
+    }
+}
+
+static void ExpectFrame(const char* engine, const char* text, uint16_t annMask)
+{
+    DMM_Frame f;
+    DMM_FrameSnapshot(&f);
+
+    CHECK(strcmp(f.text, text) == 0, "%s: text \"%s\", expected \"%s\"", engine, f.text, text);
+    for (int pos = 1; pos <= 12; pos++) {
+        CHECK(f.annunc[pos] == ((annMask >> (pos - 1)) & 1u), "%s: Annunc[%d] = %u", engine, pos, f.annunc[pos]);
+    }
+}
+
+
+//***********************************************************************************
+
+static void TestPublishedFrame(void (*feed)(const uint16_t*, int), const char* engine)
+{
+    DecoderReset();
+
+    sampleCount = 0;
+    Serialize(frameBeep, sizeof(frameBeep) / sizeof(frameBeep[0]));
+    feed(samples, sampleCount);
+    ExpectFrame(engine, "BEEP,-99999.1_", (1u << 11) | (1u << 3));
+
+    uint32_t seq = DMM_FrameGeneration();
+    CHECK(seq != 0, "%s: nothing published", engine);
+
+    // Annunciator-only update: new generation, text unchanged
+    sampleCount = 0;
+    Serialize(frameRem, sizeof(frameRem) / sizeof(frameRem[0]));
+    feed(samples, sampleCount);
+    ExpectFrame(engine, "BEEP,-99999.1_", 1u << 10);
+    CHECK(DMM_FrameGeneration() == seq + 1, "%s: generation %u after the annunciator update, expected %u", engine, DMM_FrameGeneration(), seq + 1);
+
+    // Repeat: dropped at the latch, generation stays
+    seq = DMM_FrameGeneration();
+    feed(samples, sampleCount);
+    CHECK(DMM_FrameGeneration() == seq, "%s: repeated frame published again", engine);
+}
+
+// Live Watch command counters keep the meaning they had before the opcode table
+static void TestCommandCounters(void)
+{
+    static const Txn cmds[] = {
+        { 0x060, 0, { 0 }, 1 }, { 0x068, 0, { 0 }, 1 }, { 0x069, 0, { 0 }, 1 },
+        { 0x0A7, 0, { 0 }, 1 }, { 0x0A8, 0, { 0 }, 1 }, { 0x0AF, 0, { 0 }, 1 },
+        { 0x123, 0, { 0 }, 1 }, { 0x2F0, 0, { 0 }, 1 },
+    };
+
+    DecoderReset();
+    cmdOtherCount = cmd068Count = cmd0A8Count = cmd068NearCount = cmd0A8NearCount = cmd2F0Count = 0;
+
+    sampleCount = 0;
+    Serialize(cmds, sizeof(cmds) / sizeof(cmds[0]));
+    FeedBits(samples, sampleCount);
+
+    CHECK(cmd068NearCount == 3 && cmd0A8NearCount == 3, "near counters %u / %u, expected 3 / 3", cmd068NearCount, cmd0A8NearCount);
+    CHECK(cmd068Count == 2 && cmd0A8Count == 2, "cmd068Count / cmd0A8Count %u / %u, expected 2 / 2", cmd068Count, cmd0A8Count);
+    CHECK(cmdOtherCount == 5, "cmdOtherCount %u, expected 5 (0x060 0x069 0x0A7 0x0AF 0x123)", cmdOtherCount);
+    CHECK(cmd2F0Count == 1, "cmd2F0Count %u, expected 1", cmd2F0Count);
+}
+
+// All engines on a recorded capture must agree
+static void ReplayFile(const char* path)
+{
+    FILE* f = fopen(path, "r");
+    unsigned v;
+    DMM_Frame bits, batch, words;
+
+    if (f == NULL) { failures++; printf("FAIL cannot open %s\n", path); return; }
+    sampleCount = 0;
+    while (fscanf(f, "%x", &v) == 1) Sample((uint16_t)v);
+    fclose(f);
+
+    DecoderReset();
+    FeedBits(samples, sampleCount);
+    DMM_FrameSnapshot(&bits);
+
+    DecoderReset();
+    FeedSamples(samples, sampleCount);
+    DMM_FrameSnapshot(&batch);
+
+    DecoderReset();
+    FeedWords(samples, sampleCount);
+    DMM_FrameSnapshot(&words);
+
+    printf("%s: %d samples, \"%s\"\n", path, sampleCount, bits.text);
+    CHECK(strcmp(bits.text, words.text) == 0, "engines disagree: \"%s\" / \"%s\"", bits.text, words.text);
+    CHECK(memcmp(bits.annunc, words.annunc, sizeof(bits.annunc)) == 0, "engines disagree on the annunciators");
+    CHECK(strcmp(bits.text, batch.text) == 0, "DMM_DecodeSamples disagrees: \"%s\" / \"%s\"", bits.text, batch.text);
+    CHECK(memcmp(bits.annunc, batch.annunc, sizeof(bits.annunc)) == 0, "DMM_DecodeSamples disagrees on the annunciators");
+}
+
+
+int main(int argc, char** argv)
+{
+    srand(3457);
+
+    TestPublishedFrame(FeedBits, "DMM_HandleO2Clock");
+    TestPublishedFrame(FeedSamples, "DMM_DecodeSamples");
+    TestPublishedFrame(FeedWords, "DMM_DecodeWords");
+    TestCommandCounters();
+
+    for (int i = 1; i < argc; i++) ReplayFile(argv[i]);
+
+    printf("test_decoder: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file    test_seqlock.c
+  * @brief   Host stress test of the decoded frame handoff (DMM_FramePublish /
+  *          DMM_FrameSnapshot in timer.c)
+  ******************************************************************************
+  * Every published frame is self-describing: each byte is a function of its
+  * seq, so a snapshot mixing two frames is caught. Two interleavings:
+  *   - preempt:  the writer runs from a high-rate POSIX timer signal on the
+  *               reader's thread, so it completes between any two reader
+  *               instructions, as PendSV does over the render loop
+  *   - parallel: writer and reader on separate threads, truly concurrent,
+  *               harsher than the single core target
+*/
+
+#include "../Src/timer.c"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TEST_SECONDS        1
+#define PREEMPT_PERIOD_NS   20000       // writer every 20us, against a ~100ns copy
+
+static volatile uint32_t published = 0;
+static volatile int stop = 0;
+
+
+static char Pattern(uint32_t seq, int i)
+{
+    return (char)('A' + (seq * 7u + (uint32_t)i) % 26u);
+}
+
+// Fill the decoder outputs for frame 'seq' and publish them, as DMM_FrameBuild() does
+static void Publish(uint32_t seq)
+{
+    for (int i = 0; i < 31; i++) displayWithPunct[i] = Pattern(seq, i);
+    displayWithPunct[31] = '\0';
+    for (int i = 0; i < 12; i++) {
+        displayStr[i] = Pattern(seq, i + 40);
+        punctStr[i] = Pattern(seq, i + 60);
+    }
+    displayStr[12] = '\0';
+    punctStr[12] = '\0';
+    for (int i = 0; i < 13; i++) Annunc[i] = (uint8_t)((seq >> (i % 8)) & 1u);
+
+    DMM_FramePublish(seq, seq ^ 0x5A5A5A5Au);
+}
+
+// 0 if the snapshot is one whole frame
+static int Torn(const DMM_Frame* f)
+{
+    uint32_t seq = f->seq;
+
+    if (f->tick != (seq ^ 0x5A5A5A5Au)) return 1;
+    for (int i = 0; i < 31; i++) if (f->text[i] != Pattern(seq, i)) return 1;
+    for (int i = 0; i < 12; i++) {
+        if (f->chars[i] != Pattern(seq, i + 40)) return 1;
+        if (f->punct[i] != Pattern(seq, i + 60)) return 1;
+    }
+    for (int i = 0; i < 13; i++) if (f->annunc[i] != ((seq >> (i % 8)) & 1u)) return 1;
+    return 0;
+}
+
+static int ReadUntilStopped(const char* mode)
+{
+    DMM_Frame f;
+    uint32_t reads = 0, torn = 0, last = 0, backwards = 0;
+
+    while (!stop) {
+        DMM_FrameSnapshot(&f);
+        reads++;
+        if (Torn(&f)) torn++;
+        if (f.seq < last) backwards++;
+        last = f.seq;
+    }
+
+    printf("%-8s %9u snapshots, %8u frames published, %6u retries, %u torn, %u out of order\n",
+           mode, reads, published, frameSnapshotRetries, torn, backwards);
+    return (torn == 0 && backwards == 0 && published > 1000) ? 0 : 1;
+}
+
+
+//***********************************************************************************
+
+static void WriterSignal(int sig)
+{
+    (void)sig;
+    Publish(++published);
+}
+
+static int TestPreempt(void)
+{
+    timer_t timer;
+    struct sigevent sev = { 0 };
+    struct itimerspec its = { 0 };
+    struct sigaction sa = { 0 };
+
+    published = 0;
+    stop = 0;
+    frameSnapshotRetries = 0;
+    Publish(0);
+
+    sa.sa_handler = WriterSignal;
+    sigaction(SIGRTMIN, &sa, NULL);
+    sev.sigev_notify = SIGEV_SIGNAL;            // single threaded at this point, the reader takes it
+    sev.sigev_signo = SIGRTMIN;
+    timer_create(CLOCK_MONOTONIC, &sev, &timer);
+    its.it_interval.tv_nsec = PREEMPT_PERIOD_NS;
+    its.it_value.tv_nsec = PREEMPT_PERIOD_NS;
+    timer_settime(timer, 0, &its, NULL);
+
+    time_t end = time(NULL) + TEST_SECONDS + 1;
+    DMM_Frame f;
+    uint32_t reads = 0, torn = 0;
+    while (time(NULL) < end) {
+        DMM_FrameSnapshot(&f);
+        reads++;
+        if (Torn(&f)) torn++;
+    }
+    timer_delete(timer);
+
+    printf("%-8s %9u snapshots, %8u frames published, %6u retries, %u torn\n",
+           "preempt", reads, published, frameSnapshotRetries, torn);
+    return (torn == 0 && published > 1000) ? 0 : 1;
+}
+
+
+static void* WriterThread(void* arg)
+{
+    (void)arg;
+    while (!stop) {
+        Publish(++published);
+    }
+    return NULL;
+}
+
+static void* StopThread(void* arg)
+{
+    (void)arg;
+    sleep(TEST_SECONDS);
+    stop = 1;
+    return NULL;
+}
+
+static int TestParallel(void)
+{
+    pthread_t writer, timer;
+
+    published = 0;
+    stop = 0;
+    frameSnapshotRetries = 0;
+    Publish(0);
+
+    pthread_create(&writer, NULL, WriterThread, NULL);
+    pthread_create(&timer, NULL, StopThread, NULL);
+    int result = ReadUntilStopped("parallel");
+    pthread_join(writer, NULL);
+    pthread_join(timer, NULL);
+    return result;
+}
+
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += TestPreempt();
+    failures += TestParallel();
+
+    printf("test_seqlock: %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}